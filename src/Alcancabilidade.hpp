@@ -0,0 +1,304 @@
+/**
+ * @file Alcancabilidade.hpp
+ * @brief Índice de alcançabilidade pré-calculado: responde "u alcança v?" sem
+ * percorrer o grafo.
+ *
+ * Construção:
+ * - As componentes fortemente conexas (Tarjan iterativo) são contraídas em um
+ *   DAG. Vértices da mesma componente sempre se alcançam.
+ * - Com poucas componentes, guarda o fecho transitivo do DAG como matriz de
+ *   bits: a linha de cada componente é o OU das linhas de seus sucessores,
+ *   processando as componentes da última para a primeira na ordem
+ *   topológica. Consulta O(1).
+ * - Com muitas componentes, usa rótulos de 2 saltos (pruned landmark
+ *   labeling): cada componente guarda as componentes "marco" que alcança
+ *   (saida) e que a alcançam (entrada). u alcança v se as listas de u (saida)
+ *   e de v (entrada) têm um marco em comum. As listas são curtas na prática,
+ *   e a consulta é uma interseção de duas listas ordenadas.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "IndiceCSR.hpp"
+#include "MatrizBits.hpp"
+
+class IndiceAlcancabilidade {
+  private:
+    std::vector<int> componente; ///< Componente forte de cada vértice.
+    int tComponentes = 0;
+
+    MatrizBits *fecho = nullptr; ///< Fecho transitivo (modo denso).
+
+    /// Rótulos de 2 saltos em formato CSR (modo esparso).
+    std::vector<int> inicioSaida, rotuloSaida;
+    std::vector<int> inicioEntrada, rotuloEntrada;
+
+    /**
+     * @brief Componentes fortemente conexas por Tarjan sem recursão. As
+     * componentes são numeradas na ordem em que terminam, ou seja, toda
+     * aresta entre componentes vai de um número maior para um menor.
+     */
+    template <typename D> void calcularComponentes(const IndiceCSRT<D> &g) {
+        int n = g.tamanho, contador = 0;
+        std::vector<int> ordem(n, -1), baixo(n), pilha, chamadas;
+        std::vector<D> posicao(n);
+        std::vector<bool> naPilha(n, false);
+        componente.assign(n, -1);
+
+        for (int s = 0; s < n; s++) {
+            if (ordem[s] != -1)
+                continue;
+
+            chamadas.push_back(s);
+            ordem[s] = baixo[s] = contador++;
+            posicao[s] = g.inicio[s];
+            pilha.push_back(s);
+            naPilha[s] = true;
+
+            while (!chamadas.empty()) {
+                int v = chamadas.back();
+                if (posicao[v] < g.inicio[v + 1]) {
+                    int w = g.arestas[posicao[v]++].vertice;
+                    if (ordem[w] == -1) {
+                        ordem[w] = baixo[w] = contador++;
+                        posicao[w] = g.inicio[w];
+                        pilha.push_back(w);
+                        naPilha[w] = true;
+                        chamadas.push_back(w);
+                    } else if (naPilha[w]) {
+                        baixo[v] = std::min(baixo[v], ordem[w]);
+                    }
+                    continue;
+                }
+
+                chamadas.pop_back();
+                if (!chamadas.empty())
+                    baixo[chamadas.back()] =
+                        std::min(baixo[chamadas.back()], baixo[v]);
+
+                if (baixo[v] == ordem[v]) {
+                    int w;
+                    do {
+                        w = pilha.back();
+                        pilha.pop_back();
+                        naPilha[w] = false;
+                        componente[w] = tComponentes;
+                    } while (w != v);
+                    tComponentes++;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Monta o DAG das componentes, sem arestas repetidas (até INT_MAX
+     * arestas entre componentes).
+     */
+    template <typename D>
+    void condensar(const IndiceCSRT<D> &g, std::vector<int> &inicio,
+                   std::vector<int> &destinos) {
+        std::vector<std::vector<int>> sucessores(tComponentes);
+        for (int u = 0; u < g.tamanho; u++)
+            for (const tupla *t = g.inicioVizinhos(u); t != g.fimVizinhos(u);
+                 t++)
+                if (componente[u] != componente[t->vertice])
+                    sucessores[componente[u]].push_back(
+                        componente[t->vertice]);
+
+        inicio.assign(tComponentes + 1, 0);
+        destinos.clear();
+        for (int c = 0; c < tComponentes; c++) {
+            std::vector<int> &s = sucessores[c];
+            std::sort(s.begin(), s.end());
+            s.erase(std::unique(s.begin(), s.end()), s.end());
+            destinos.insert(destinos.end(), s.begin(), s.end());
+            inicio[c + 1] = int(destinos.size());
+        }
+    }
+
+    /**
+     * @brief Fecho transitivo do DAG com OU de linhas de bits.
+     */
+    void construirFecho(const std::vector<int> &inicio,
+                        const std::vector<int> &destinos) {
+        fecho = new MatrizBits(tComponentes, tComponentes);
+        for (int c = 0; c < tComponentes; c++) {
+            fecho->ligar(c, c);
+            // Sucessores têm número menor e já estão fechados
+            for (int k = inicio[c]; k < inicio[c + 1]; k++)
+                fecho->unirLinha(c, destinos[k]);
+        }
+    }
+
+    /**
+     * @brief Verifica se duas listas ordenadas têm algum elemento em comum.
+     */
+    static bool intersectam(const int *a, const int *aFim, const int *b,
+                            const int *bFim) {
+        while (a != aFim && b != bFim) {
+            if (*a < *b)
+                a++;
+            else if (*a > *b)
+                b++;
+            else
+                return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Rótulos de 2 saltos por buscas podadas a partir de cada
+     * componente, das mais conectadas para as menos conectadas.
+     */
+    void construirRotulos(const std::vector<int> &inicio,
+                          const std::vector<int> &destinos) {
+        int c = tComponentes;
+
+        // DAG reverso, para as buscas para trás
+        std::vector<int> inicioRev(c + 1, 0), origens(destinos.size());
+        for (int d : destinos)
+            inicioRev[d + 1]++;
+        for (int i = 0; i < c; i++)
+            inicioRev[i + 1] += inicioRev[i];
+        std::vector<int> pos(inicioRev.begin(), inicioRev.end() - 1);
+        for (int u = 0; u < c; u++)
+            for (int k = inicio[u]; k < inicio[u + 1]; k++)
+                origens[pos[destinos[k]]++] = u;
+
+        std::vector<int> ordem(c);
+        for (int i = 0; i < c; i++)
+            ordem[i] = i;
+        auto importancia = [&](int x) {
+            return (long long)(inicio[x + 1] - inicio[x] + 1) *
+                   (inicioRev[x + 1] - inicioRev[x] + 1);
+        };
+        std::stable_sort(ordem.begin(), ordem.end(), [&](int a, int b) {
+            return importancia(a) > importancia(b);
+        });
+
+        std::vector<std::vector<int>> saida(c), entrada(c);
+        std::vector<int> marca(c, -1), fila;
+        auto alcancado = [&](int x, int y) {
+            return intersectam(saida[x].data(),
+                               saida[x].data() + saida[x].size(),
+                               entrada[y].data(),
+                               entrada[y].data() + entrada[y].size());
+        };
+        auto buscar = [&](int raiz, int posto, const std::vector<int> &ini,
+                          const std::vector<int> &viz, bool frente) {
+            fila.clear();
+            fila.push_back(raiz);
+            marca[raiz] = 2 * posto + frente;
+            for (std::size_t i = 0; i < fila.size(); i++) {
+                int w = fila[i];
+                // Poda: a alcançabilidade já é coberta por outro marco
+                if (frente ? alcancado(raiz, w) : alcancado(w, raiz))
+                    continue;
+                (frente ? entrada[w] : saida[w]).push_back(posto);
+                for (int k = ini[w]; k < ini[w + 1]; k++) {
+                    int x = viz[k];
+                    if (marca[x] != 2 * posto + frente) {
+                        marca[x] = 2 * posto + frente;
+                        fila.push_back(x);
+                    }
+                }
+            }
+        };
+
+        // Os marcos são identificados pelo posto, então cada lista cresce em
+        // ordem crescente e já fica ordenada
+        for (int posto = 0; posto < c; posto++) {
+            int v = ordem[posto];
+            buscar(v, posto, inicio, destinos, true);
+            buscar(v, posto, inicioRev, origens, false);
+        }
+
+        auto achatar = [&](std::vector<std::vector<int>> &listas,
+                           std::vector<int> &ini, std::vector<int> &rotulos) {
+            ini.assign(c + 1, 0);
+            for (int i = 0; i < c; i++)
+                ini[i + 1] = ini[i] + int(listas[i].size());
+            rotulos.resize(ini[c]);
+            for (int i = 0; i < c; i++) {
+                std::copy(listas[i].begin(), listas[i].end(),
+                          rotulos.begin() + ini[i]);
+                std::vector<int>().swap(listas[i]);
+            }
+        };
+        achatar(saida, inicioSaida, rotuloSaida);
+        achatar(entrada, inicioEntrada, rotuloEntrada);
+    }
+
+  public:
+    /**
+     * @brief Quantidade máxima de componentes para usar a matriz de bits
+     * (16384 componentes = 32 MB).
+     */
+    static const int LIMITE_FECHO = 16384;
+
+    /**
+     * @brief Constrói o índice para o grafo descrito por g.
+     *
+     * @param g Índice de vizinhos de saída.
+     * @param limiteFecho Usa o fecho em bits se houver até este número de
+     * componentes; senão, rótulos de 2 saltos.
+     */
+    template <typename D>
+    explicit IndiceAlcancabilidade(const IndiceCSRT<D> &g,
+                                   int limiteFecho = LIMITE_FECHO) {
+        calcularComponentes(g);
+
+        std::vector<int> inicio, destinos;
+        condensar(g, inicio, destinos);
+
+        if (tComponentes <= limiteFecho)
+            construirFecho(inicio, destinos);
+        else
+            construirRotulos(inicio, destinos);
+    }
+
+    IndiceAlcancabilidade(const IndiceAlcancabilidade &) = delete;
+    IndiceAlcancabilidade &operator=(const IndiceAlcancabilidade &) = delete;
+
+    ~IndiceAlcancabilidade() { delete fecho; }
+
+    /**
+     * @brief Verifica se existe caminho do vértice u até o vértice v.
+     */
+    bool alcanca(int u, int v) const {
+        int cu = componente[u], cv = componente[v];
+        if (cu == cv)
+            return true;
+        // Arestas entre componentes só vão para números menores
+        if (cu < cv)
+            return false;
+        if (fecho != nullptr)
+            return fecho->testar(cu, cv);
+
+        return intersectam(rotuloSaida.data() + inicioSaida[cu],
+                           rotuloSaida.data() + inicioSaida[cu + 1],
+                           rotuloEntrada.data() + inicioEntrada[cv],
+                           rotuloEntrada.data() + inicioEntrada[cv + 1]);
+    }
+
+    /**
+     * @brief Componente fortemente conexa do vértice v.
+     */
+    int getComponente(int v) const { return componente[v]; }
+
+    int getTComponentes() const { return tComponentes; }
+
+    std::size_t getMemoriaOcupada() const {
+        std::size_t t = sizeof(IndiceAlcancabilidade);
+        t += sizeof(int) * (componente.size() + inicioSaida.size() +
+                            rotuloSaida.size() + inicioEntrada.size() +
+                            rotuloEntrada.size());
+        if (fecho != nullptr)
+            t += fecho->getMemoriaOcupada();
+        return t;
+    }
+};
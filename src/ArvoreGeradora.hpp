@@ -0,0 +1,275 @@
+/**
+ * @file ArvoreGeradora.hpp
+ * @brief Floresta geradora mínima de grafos não direcionados (Borůvka
+ * paralelo e Kruskal com ordenação radix paralela).
+ *
+ * Os pesos são comparados como (peso, índice da aresta), o que torna todos
+ * distintos: as duas estratégias retornam sempre a mesma floresta.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "IndiceCSR.hpp"
+#include "Implementacao.hpp"
+#include "Paralelo.hpp"
+
+/**
+ * @class UniaoBusca
+ * @brief Conjuntos disjuntos com união por tamanho e compressão de caminho.
+ */
+class UniaoBusca {
+  private:
+    std::vector<int> pai, tamanho;
+
+  public:
+    explicit UniaoBusca(int n) : pai(n), tamanho(n, 1) {
+        for (int i = 0; i < n; i++)
+            pai[i] = i;
+    }
+
+    int buscar(int x) {
+        while (pai[x] != x) {
+            pai[x] = pai[pai[x]];
+            x = pai[x];
+        }
+        return x;
+    }
+
+    /**
+     * @brief Representante de x sem compressão de caminho; pode ser chamado
+     * por várias threads enquanto nenhuma união acontece.
+     */
+    int raiz(int x) const {
+        while (pai[x] != x)
+            x = pai[x];
+        return x;
+    }
+
+    /**
+     * @return true se x e y estavam em conjuntos diferentes.
+     */
+    bool unir(int x, int y) {
+        x = buscar(x);
+        y = buscar(y);
+        if (x == y)
+            return false;
+        if (tamanho[x] < tamanho[y])
+            std::swap(x, y);
+        pai[y] = x;
+        tamanho[x] += tamanho[y];
+        return true;
+    }
+};
+
+/**
+ * @brief Lista as arestas u - v de um índice simétrico com u < v (laços são
+ * descartados).
+ */
+template <typename D>
+std::vector<tAresta> listarArestasNaoDirecionadas(const IndiceCSRT<D> &g) {
+    std::vector<tAresta> arestas;
+    arestas.reserve(g.tArestas / 2);
+    for (int u = 0; u < g.tamanho; u++)
+        for (const tupla *t = g.inicioVizinhos(u); t != g.fimVizinhos(u); t++)
+            if (u < t->vertice)
+                arestas.push_back({u, t->vertice, t->peso});
+    return arestas;
+}
+
+/**
+ * @brief Converte um peso para uma chave sem sinal com a mesma ordem.
+ */
+inline std::uint32_t chavePeso(int peso) {
+    return std::uint32_t(peso) ^ 0x80000000u;
+}
+
+/**
+ * @brief Ordena as arestas por peso com radix sort LSD (4 passadas de 8
+ * bits), estável e paralelo: cada thread monta o histograma de seu trecho e
+ * depois espalha as arestas nas posições calculadas pelas somas de prefixo.
+ */
+inline void ordenarPorPeso(std::vector<tAresta> &arestas, int threads = 0) {
+    int n = int(arestas.size());
+    if (threads <= 0)
+        threads = numeroThreads();
+    threads = std::max(1, std::min(threads, n));
+
+    std::vector<tAresta> temp(n);
+    std::vector<int> contagem(threads * 256);
+    tAresta *origem = arestas.data(), *destino = temp.data();
+
+    for (int deslocamento = 0; deslocamento < 32; deslocamento += 8) {
+        auto digito = [&](const tAresta &a) {
+            return (chavePeso(a.peso) >> deslocamento) & 0xFF;
+        };
+
+        std::fill(contagem.begin(), contagem.end(), 0);
+        paraCadaParte(threads, [&](int p) {
+            int *c = &contagem[p * 256];
+            int fim = (long long)n * (p + 1) / threads;
+            for (int i = (long long)n * p / threads; i < fim; i++)
+                c[digito(origem[i])]++;
+        });
+
+        // Posição inicial de cada (dígito, thread), em ordem estável
+        int soma = 0;
+        for (int d = 0; d < 256; d++) {
+            for (int p = 0; p < threads; p++) {
+                int c = contagem[p * 256 + d];
+                contagem[p * 256 + d] = soma;
+                soma += c;
+            }
+        }
+
+        paraCadaParte(threads, [&](int p) {
+            int *c = &contagem[p * 256];
+            int fim = (long long)n * (p + 1) / threads;
+            for (int i = (long long)n * p / threads; i < fim; i++)
+                destino[c[digito(origem[i])]++] = origem[i];
+        });
+        std::swap(origem, destino);
+    }
+    // Número par de passadas: o resultado está de volta em `arestas`
+}
+
+/**
+ * @brief Floresta geradora mínima pelo algoritmo de Kruskal.
+ *
+ * @param g Índice simétrico e ponderado, com no máximo INT_MAX arestas
+ * u - v (o dobro no índice).
+ * @param floresta Recebe as arestas escolhidas (origem < destino).
+ * @param threads Threads usadas na ordenação (0 usa numeroThreads()).
+ * @return Soma dos pesos da floresta.
+ */
+template <typename D>
+long long kruskal(const IndiceCSRT<D> &g, std::vector<tAresta> &floresta,
+                  int threads = 0) {
+    std::vector<tAresta> arestas = listarArestasNaoDirecionadas(g);
+    ordenarPorPeso(arestas, threads);
+
+    UniaoBusca conjuntos(g.tamanho);
+    long long total = 0;
+    floresta.clear();
+    for (const tAresta &a : arestas) {
+        if ((int)floresta.size() == g.tamanho - 1)
+            break;
+        if (conjuntos.unir(a.origem, a.destino)) {
+            floresta.push_back(a);
+            total += a.peso;
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Floresta geradora mínima pelo algoritmo de Borůvka, em paralelo.
+ *
+ * A cada rodada, cada componente escolhe a aresta mais leve que sai dela
+ * (mínimo atômico sobre a chave (peso, índice)), as componentes ligadas por
+ * essas arestas são contraídas e as arestas internas são descartadas. O
+ * número de componentes ao menos cai pela metade a cada rodada.
+ *
+ * @param g Índice simétrico e ponderado, com no máximo INT_MAX arestas
+ * u - v (o dobro no índice).
+ * @param floresta Recebe as arestas escolhidas (origem < destino).
+ * @param threads Quantidade de threads (0 usa numeroThreads()).
+ * @return Soma dos pesos da floresta.
+ */
+template <typename D>
+long long boruvka(const IndiceCSRT<D> &g, std::vector<tAresta> &floresta,
+                  int threads = 0) {
+    int n = g.tamanho;
+    std::vector<tAresta> arestas = listarArestasNaoDirecionadas(g);
+    if (threads <= 0)
+        threads = numeroThreads();
+
+    const std::uint64_t NENHUMA = UINT64_MAX;
+    std::vector<int> componente(n), ativas(arestas.size());
+    std::vector<std::atomic<std::uint64_t>> melhor(n);
+    for (int v = 0; v < n; v++) {
+        componente[v] = v;
+        melhor[v].store(NENHUMA, std::memory_order_relaxed);
+    }
+    for (std::size_t i = 0; i < arestas.size(); i++)
+        ativas[i] = int(i);
+
+    UniaoBusca conjuntos(n);
+    std::vector<int> mantidas(threads);
+    long long total = 0;
+    floresta.clear();
+
+    while (!ativas.empty()) {
+        int m = int(ativas.size());
+        int partes = std::max(1, std::min(threads, m));
+
+        // 1. Aresta mais leve de cada componente
+        paraCadaParte(partes, [&](int p) {
+            int fim = (long long)m * (p + 1) / partes;
+            for (int i = (long long)m * p / partes; i < fim; i++) {
+                const tAresta &a = arestas[ativas[i]];
+                std::uint64_t chave = std::uint64_t(chavePeso(a.peso)) << 32 |
+                                      unsigned(ativas[i]);
+                int lados[2] = {componente[a.origem], componente[a.destino]};
+                for (int c : lados) {
+                    std::uint64_t atual =
+                        melhor[c].load(std::memory_order_relaxed);
+                    while (chave < atual &&
+                           !melhor[c].compare_exchange_weak(
+                               atual, chave, std::memory_order_relaxed))
+                        ;
+                }
+            }
+        });
+
+        // 2. Une as componentes pelas arestas escolhidas
+        bool uniu = false;
+        for (int c = 0; c < n; c++) {
+            std::uint64_t chave = melhor[c].load(std::memory_order_relaxed);
+            if (chave == NENHUMA)
+                continue;
+            melhor[c].store(NENHUMA, std::memory_order_relaxed);
+
+            const tAresta &a = arestas[chave & 0xFFFFFFFFu];
+            if (conjuntos.unir(a.origem, a.destino)) {
+                floresta.push_back(a);
+                total += a.peso;
+                uniu = true;
+            }
+        }
+        if (!uniu)
+            break;
+
+        // 3. Contração: rótulo de componente = representante do conjunto
+        int partesV = std::max(1, std::min(threads, n));
+        paraCadaParte(partesV, [&](int p) {
+            int fim = (long long)n * (p + 1) / partesV;
+            for (int v = (long long)n * p / partesV; v < fim; v++)
+                componente[v] = conjuntos.raiz(v);
+        });
+
+        // 4. Descarta as arestas internas às componentes
+        paraCadaParte(partes, [&](int p) {
+            int fim = (long long)m * (p + 1) / partes, k = 0;
+            int inicio = (long long)m * p / partes;
+            for (int i = inicio; i < fim; i++) {
+                const tAresta &a = arestas[ativas[i]];
+                if (componente[a.origem] != componente[a.destino])
+                    ativas[inicio + k++] = ativas[i];
+            }
+            mantidas[p] = k;
+        });
+        int k = 0;
+        for (int p = 0; p < partes; p++) {
+            int inicio = (long long)m * p / partes;
+            for (int i = 0; i < mantidas[p]; i++)
+                ativas[k++] = ativas[inicio + i];
+        }
+        ativas.resize(k);
+    }
+    return total;
+}
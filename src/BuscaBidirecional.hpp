@@ -0,0 +1,141 @@
+/**
+ * @file BuscaBidirecional.hpp
+ * @brief Caminho mínimo (em número de arestas) entre dois vértices por busca
+ * em largura bidirecional.
+ *
+ * Uma busca parte da origem pelos vizinhos de saída e outra parte do destino
+ * pelos vizinhos de entrada. A cada passo é expandido um nível inteiro do lado
+ * com a menor fronteira; quando os lados se encontram, o melhor encontro
+ * daquele nível dá a distância mínima. Em grafos grandes isso visita uma
+ * fração pequena dos vértices que uma busca completa visitaria.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "IndiceCSR.hpp"
+
+/**
+ * @struct EspacoBidirecional
+ * @brief Vetores de trabalho reaproveitados entre consultas.
+ *
+ * Cada posição guarda a consulta em que foi escrita; valores de consultas
+ * anteriores são ignorados, então os vetores não precisam ser limpos a cada
+ * consulta (que custaria O(V) mesmo para caminhos curtos).
+ */
+struct EspacoBidirecional {
+    std::vector<unsigned> consultaFrente, consultaTras;
+    std::vector<int> paiFrente, paiTras;
+    std::vector<int> distFrente, distTras;
+    std::vector<int> fronteiraFrente, fronteiraTras, proxima;
+    unsigned consulta = 0;
+
+    /**
+     * @brief Prepara os vetores para um grafo com n vértices e inicia uma
+     * nova consulta.
+     */
+    void iniciar(int n) {
+        if ((int)paiFrente.size() != n || ++consulta == 0) {
+            consultaFrente.assign(n, 0);
+            consultaTras.assign(n, 0);
+            paiFrente.resize(n);
+            paiTras.resize(n);
+            distFrente.resize(n);
+            distTras.resize(n);
+            consulta = 1;
+        }
+        fronteiraFrente.clear();
+        fronteiraTras.clear();
+    }
+};
+
+/**
+ * @brief Expande um nível de um dos lados da busca bidirecional.
+ *
+ * @return Vértice de encontro que minimiza a distância total neste nível, ou
+ * -1 se os lados não se encontraram.
+ */
+template <typename D>
+int expandirNivel(const IndiceCSRT<D> &g, EspacoBidirecional &e,
+                  std::vector<int> &fronteira, std::vector<unsigned> &consulta,
+                  std::vector<int> &pai, std::vector<int> &dist,
+                  const std::vector<unsigned> &consultaOutro,
+                  const std::vector<int> &distOutro, int &melhor) {
+    int encontro = -1;
+    e.proxima.clear();
+    for (int u : fronteira) {
+        for (const tupla *t = g.inicioVizinhos(u); t != g.fimVizinhos(u); t++) {
+            int w = t->vertice;
+            if (consulta[w] == e.consulta)
+                continue;
+            consulta[w] = e.consulta;
+            pai[w] = u;
+            dist[w] = dist[u] + 1;
+            e.proxima.push_back(w);
+
+            if (consultaOutro[w] == e.consulta &&
+                dist[w] + distOutro[w] < melhor) {
+                melhor = dist[w] + distOutro[w];
+                encontro = w;
+            }
+        }
+    }
+    fronteira.swap(e.proxima);
+    return encontro;
+}
+
+/**
+ * @brief Calcula um caminho mínimo de s até t.
+ *
+ * @param saida Índice de vizinhos de saída.
+ * @param entrada Índice de vizinhos de entrada (o próprio índice de saída em
+ * grafos não direcionados).
+ * @param s Vértice de origem.
+ * @param t Vértice de destino.
+ * @param e Vetores de trabalho reaproveitáveis.
+ * @param caminho Recebe os vértices do caminho, de s até t.
+ * @return Quantidade de arestas do caminho, ou -1 se t não for alcançável.
+ */
+template <typename D>
+int buscaBidirecional(const IndiceCSRT<D> &saida, const IndiceCSRT<D> &entrada,
+                      int s, int t, EspacoBidirecional &e,
+                      std::vector<int> &caminho) {
+    caminho.clear();
+    e.iniciar(saida.tamanho);
+
+    e.consultaFrente[s] = e.consulta;
+    e.paiFrente[s] = -1;
+    e.distFrente[s] = 0;
+    e.fronteiraFrente.push_back(s);
+    e.consultaTras[t] = e.consulta;
+    e.paiTras[t] = -1;
+    e.distTras[t] = 0;
+    e.fronteiraTras.push_back(t);
+
+    int melhor = s == t ? 0 : 0x7FFFFFFF, encontro = s == t ? s : -1;
+    while (encontro == -1 && !e.fronteiraFrente.empty() &&
+           !e.fronteiraTras.empty()) {
+        int w;
+        if (e.fronteiraFrente.size() <= e.fronteiraTras.size())
+            w = expandirNivel(saida, e, e.fronteiraFrente, e.consultaFrente,
+                              e.paiFrente, e.distFrente, e.consultaTras,
+                              e.distTras, melhor);
+        else
+            w = expandirNivel(entrada, e, e.fronteiraTras, e.consultaTras,
+                              e.paiTras, e.distTras, e.consultaFrente,
+                              e.distFrente, melhor);
+        encontro = w;
+    }
+
+    if (encontro == -1)
+        return -1;
+
+    for (int v = encontro; v != -1; v = e.paiFrente[v])
+        caminho.push_back(v);
+    std::reverse(caminho.begin(), caminho.end());
+    for (int v = e.paiTras[encontro]; v != -1; v = e.paiTras[v])
+        caminho.push_back(v);
+    return melhor;
+}
@@ -0,0 +1,212 @@
+/**
+ * @file BuscaMultipla.hpp
+ * @brief Busca em largura simultânea a partir de várias origens (MS-BFS).
+ *
+ * Cada vértice guarda uma máscara de bits com uma posição por origem. Uma
+ * única leitura da lista de vizinhos de um vértice da fronteira propaga, com
+ * um OU bit a bit, todas as buscas que chegaram a ele no mesmo nível. Com
+ * máscaras de 64 bits são processadas 64 origens por vez; com 256 bits, 256
+ * origens (uma operação AVX2 por vértice quando disponível).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "IndiceCSR.hpp"
+
+/**
+ * @struct Mascara
+ * @brief Conjunto de W palavras de 64 bits, uma posição por origem.
+ */
+template <int W> struct Mascara {
+    std::uint64_t p[W];
+
+    void zerar() {
+        for (int i = 0; i < W; i++)
+            p[i] = 0;
+    }
+
+    bool vazia() const {
+        std::uint64_t r = 0;
+        for (int i = 0; i < W; i++)
+            r |= p[i];
+        return r == 0;
+    }
+
+    void ou(const Mascara &m) {
+        for (int i = 0; i < W; i++)
+            p[i] |= m.p[i];
+    }
+
+    /**
+     * @brief Retorna (*this & ~visto) e acrescenta o resultado a visto.
+     */
+    Mascara novos(Mascara &visto) const {
+        Mascara r;
+        for (int i = 0; i < W; i++) {
+            r.p[i] = p[i] & ~visto.p[i];
+            visto.p[i] |= r.p[i];
+        }
+        return r;
+    }
+};
+
+#ifdef __AVX2__
+template <> inline void Mascara<4>::ou(const Mascara<4> &m) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(m.p));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p),
+                        _mm256_or_si256(a, b));
+}
+
+template <> inline bool Mascara<4>::vazia() const {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    return _mm256_testz_si256(a, a);
+}
+#endif
+
+/**
+ * @struct EspacoBuscaMultipla
+ * @brief Máscaras e fronteiras da MS-BFS, reaproveitadas entre chamadas.
+ *
+ * Ao fim de cada busca `atual` e `proximo` voltam a ficar zeradas; só
+ * `visto` precisa ser limpa antes da próxima.
+ */
+template <int W> struct EspacoBuscaMultipla {
+    std::vector<Mascara<W>> visto, atual, proximo;
+    std::vector<int> fronteira, novaFronteira;
+
+    /**
+     * @brief Prepara os vetores para um grafo com n vértices.
+     */
+    void iniciar(int n) {
+        if ((int)visto.size() != n) {
+            visto.resize(n);
+            atual.resize(n);
+            proximo.resize(n);
+            for (int v = 0; v < n; v++) {
+                atual[v].zerar();
+                proximo[v].zerar();
+            }
+        }
+        for (int v = 0; v < n; v++)
+            visto[v].zerar();
+        fronteira.clear();
+        novaFronteira.clear();
+    }
+};
+
+/**
+ * @brief Executa a MS-BFS para até 64 * W origens.
+ *
+ * @param g Índice de vizinhos de saída.
+ * @param origens Vértices de origem (índices internos).
+ * @param k Quantidade de origens (no máximo 64 * W).
+ * @param e Vetores de trabalho reaproveitáveis.
+ * @param visitar Chamada como visitar(i, w, nivel) quando a busca a partir
+ * de origens[i] alcança o vértice w, a nivel arestas de distância (inclusive
+ * nivel 0, para a própria origem).
+ */
+template <int W, typename D, typename F>
+void buscaEmLarguraMultiplaBloco(const IndiceCSRT<D> &g, const int *origens,
+                                 int k, EspacoBuscaMultipla<W> &e, F visitar) {
+    e.iniciar(g.tamanho);
+    std::vector<Mascara<W>> &visto = e.visto, &atual = e.atual,
+                            &proximo = e.proximo;
+    std::vector<int> &fronteira = e.fronteira, &novaFronteira = e.novaFronteira;
+
+    for (int i = 0; i < k; i++) {
+        int s = origens[i];
+        std::uint64_t bit = std::uint64_t(1) << (i % 64);
+        if (atual[s].vazia())
+            fronteira.push_back(s);
+        atual[s].p[i / 64] |= bit;
+        visto[s].p[i / 64] |= bit;
+        visitar(i, s, 0);
+    }
+
+    for (int nivel = 1; !fronteira.empty(); nivel++) {
+        // Expansão: cada lista de vizinhos é lida uma vez para todas as origens
+        for (int v : fronteira) {
+            for (const tupla *t = g.inicioVizinhos(v); t != g.fimVizinhos(v);
+                 t++) {
+                Mascara<W> &m = proximo[t->vertice];
+                if (m.vazia())
+                    novaFronteira.push_back(t->vertice);
+                m.ou(atual[v]);
+            }
+            atual[v].zerar();
+        }
+
+        // Filtra as origens que já tinham visitado cada vértice
+        std::size_t ativos = 0;
+        for (int w : novaFronteira) {
+            Mascara<W> m = proximo[w].novos(visto[w]);
+            proximo[w].zerar();
+            if (m.vazia())
+                continue;
+
+            atual[w] = m;
+            novaFronteira[ativos++] = w;
+            for (int j = 0; j < W; j++) {
+                std::uint64_t bits = m.p[j];
+                while (bits) {
+                    visitar(j * 64 + __builtin_ctzll(bits), w, nivel);
+                    bits &= bits - 1;
+                }
+            }
+        }
+        novaFronteira.resize(ativos);
+        fronteira.swap(novaFronteira);
+        novaFronteira.clear();
+    }
+}
+
+/**
+ * @brief Executa a MS-BFS para até 64 * W origens, escrevendo as distâncias
+ * na matriz k x g.tamanho (-1 se o vértice não for alcançável).
+ */
+template <int W, typename D>
+void buscaEmLarguraMultiplaBloco(const IndiceCSRT<D> &g, const int *origens,
+                                 int k, int *distancias) {
+    int n = g.tamanho;
+    std::fill(distancias, distancias + (std::size_t)k * n, -1);
+    EspacoBuscaMultipla<W> e;
+    buscaEmLarguraMultiplaBloco<W>(g, origens, k, e, [&](int i, int w, int d) {
+        distancias[(std::size_t)i * n + w] = d;
+    });
+}
+
+/**
+ * @brief Executa buscas em largura a partir de k origens, compartilhando a
+ * leitura das arestas entre elas.
+ *
+ * As origens são processadas em blocos de 256 (ou um único bloco de 64 quando
+ * houver poucas origens).
+ *
+ * @param g Índice de vizinhos de saída.
+ * @param origens Vértices de origem (índices internos).
+ * @param k Quantidade de origens.
+ * @param distancias Matriz k x g.tamanho de distâncias (-1 se inalcançável).
+ */
+template <typename D>
+void buscaEmLarguraMultipla(const IndiceCSRT<D> &g, const int *origens, int k,
+                            int *distancias) {
+    if (k <= 64) {
+        buscaEmLarguraMultiplaBloco<1>(g, origens, k, distancias);
+        return;
+    }
+
+    for (int i = 0; i < k; i += 256) {
+        int bloco = std::min(256, k - i);
+        buscaEmLarguraMultiplaBloco<4>(g, origens + i, bloco,
+                                       distancias + (std::size_t)i * g.tamanho);
+    }
+}
@@ -0,0 +1,154 @@
+/**
+ * @file CaminhosMinimos.hpp
+ * @brief Caminhos mínimos entre todos os pares (Floyd-Warshall em blocos).
+ *
+ * A matriz de distâncias é contígua, com largura múltipla do tamanho do
+ * bloco, e é processada em blocos de BLOCO_FW x BLOCO_FW que cabem na cache.
+ * Para cada bloco k da diagonal:
+ * 1. o próprio bloco (k, k) é fechado com Floyd-Warshall comum;
+ * 2. os blocos da linha k e da coluna k são atualizados a partir dele;
+ * 3. todos os demais blocos (i, j) recebem min(D(i, j), D(i, k) + D(k, j)).
+ * As fases 2 e 3 são divididas entre threads. O laço interno do produto
+ * min-plus percorre linhas contíguas de tamanho fixo: com AVX2 (-mavx2) ele
+ * usa soma, mínimo e máximo de 8 inteiros por instrução; sem AVX2 fica a
+ * cargo da vetorização do compilador (-O3).
+ *
+ * As distâncias ficam sempre em [-INFINITO, INFINITO]: a soma de duas delas
+ * cabe em um int, e o resultado é limitado por baixo a -INFINITO.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "Paralelo.hpp"
+
+/**
+ * @brief Distância usada para pares sem caminho. A soma de duas distâncias
+ * infinitas não estoura um int.
+ */
+const int INFINITO = std::numeric_limits<int>::max() / 2;
+
+/**
+ * @brief Lado dos blocos (64 x 64 inteiros = 16 KB por bloco).
+ */
+const int BLOCO_FW = 64;
+
+/**
+ * @brief Arredonda n para cima até um múltiplo de BLOCO_FW.
+ */
+inline int larguraBlocada(int n) {
+    return (n + BLOCO_FW - 1) / BLOCO_FW * BLOCO_FW;
+}
+
+/**
+ * @brief ci[j] = max(min(ci[j], aik + bk[j]), -INFINITO) para as BLOCO_FW
+ * colunas de uma linha de bloco. ci pode coincidir com bk.
+ */
+inline void minMaisLinha(int *ci, int aik, const int *bk) {
+#ifdef __AVX2__
+    const __m256i a = _mm256_set1_epi32(aik);
+    const __m256i piso = _mm256_set1_epi32(-INFINITO);
+    for (int j = 0; j < BLOCO_FW; j += 8) {
+        __m256i c = _mm256_loadu_si256((const __m256i *)(ci + j));
+        __m256i b = _mm256_loadu_si256((const __m256i *)(bk + j));
+        c = _mm256_min_epi32(c, _mm256_add_epi32(a, b));
+        _mm256_storeu_si256((__m256i *)(ci + j), _mm256_max_epi32(c, piso));
+    }
+#else
+    for (int j = 0; j < BLOCO_FW; j++)
+        ci[j] = std::max(std::min(ci[j], aik + bk[j]), -INFINITO);
+#endif
+}
+
+/**
+ * @brief C = min(C, A + B) no semianel min-plus, para blocos sem
+ * sobreposição.
+ *
+ * @param largura Distância, em inteiros, entre linhas consecutivas.
+ */
+inline void minMaisBloco(int *__restrict c, const int *__restrict a,
+                         const int *__restrict b, int largura) {
+    for (int i = 0; i < BLOCO_FW; i++) {
+        int *ci = c + (long long)i * largura;
+        const int *ai = a + (long long)i * largura;
+        for (int k = 0; k < BLOCO_FW; k++)
+            minMaisLinha(ci, ai[k], b + (long long)k * largura);
+    }
+}
+
+/**
+ * @brief Mesma operação de minMaisBloco quando C coincide com A ou com B
+ * (fases 1 e 2). O laço em k precisa ser o externo.
+ */
+inline void minMaisBlocoSobreposto(int *c, const int *a, const int *b,
+                                   int largura) {
+    for (int k = 0; k < BLOCO_FW; k++) {
+        const int *bk = b + (long long)k * largura;
+        for (int i = 0; i < BLOCO_FW; i++)
+            minMaisLinha(c + (long long)i * largura,
+                         a[(long long)i * largura + k], bk);
+    }
+}
+
+/**
+ * @brief Floyd-Warshall em blocos, no lugar.
+ *
+ * @param dist Matriz largura x largura: dist[u * largura + v] é o peso da
+ * aresta u -> v, 0 na diagonal e INFINITO sem aresta (inclusive nas posições
+ * de preenchimento). Todos os valores devem estar em [-INFINITO, INFINITO].
+ * Com pesos negativos, distâncias acima de INFINITO / 2 devem ser lidas como
+ * ausência de caminho.
+ * @param largura Múltiplo de BLOCO_FW (ver larguraBlocada).
+ * @param threads Quantidade de threads (0 usa numeroThreads()).
+ */
+inline void floydWarshallBlocado(int *dist, int largura, int threads = 0) {
+    int blocos = largura / BLOCO_FW;
+    if (threads <= 0)
+        threads = numeroThreads();
+
+    auto bloco = [&](int i, int j) {
+        return dist + ((long long)i * largura + j) * BLOCO_FW;
+    };
+
+    for (int k = 0; k < blocos; k++) {
+        int *diagonal = bloco(k, k);
+        minMaisBlocoSobreposto(diagonal, diagonal, diagonal, largura);
+
+        // Fase 2: linha k (tarefas pares) e coluna k (tarefas ímpares)
+        int tarefas = 2 * blocos;
+        int partes = std::max(1, std::min(threads, tarefas));
+        paraCadaParte(partes, [&](int p) {
+            for (int t = p; t < tarefas; t += partes) {
+                int outro = t / 2;
+                if (outro == k)
+                    continue;
+                if (t % 2 == 0) {
+                    int *c = bloco(k, outro);
+                    minMaisBlocoSobreposto(c, diagonal, c, largura);
+                } else {
+                    int *c = bloco(outro, k);
+                    minMaisBlocoSobreposto(c, c, diagonal, largura);
+                }
+            }
+        });
+
+        // Fase 3: blocos restantes, que só leem a linha e a coluna k
+        tarefas = blocos * blocos;
+        partes = std::max(1, std::min(threads, tarefas));
+        paraCadaParte(partes, [&](int p) {
+            int fim = (long long)tarefas * (p + 1) / partes;
+            for (int t = (long long)tarefas * p / partes; t < fim; t++) {
+                int i = t / blocos, j = t % blocos;
+                if (i == k || j == k)
+                    continue;
+                minMaisBloco(bloco(i, j), bloco(i, k), bloco(k, j), largura);
+            }
+        });
+    }
+}
@@ -0,0 +1,201 @@
+/**
+ * @file Centralidade.hpp
+ * @brief Centralidade de intermediação (betweenness) pelo algoritmo de
+ * Brandes, em paralelo sobre as origens, com modo aproximado por amostragem.
+ *
+ * Para cada origem s:
+ * 1. uma busca (em largura, ou Dijkstra se ponderado) calcula as distâncias
+ *    e sigma[v], a quantidade de caminhos mínimos de s até v, e registra os
+ *    vértices na ordem em que foram fechados;
+ * 2. na ordem inversa, a dependência de cada vértice w é acumulada a partir
+ *    dos sucessores x no DAG de caminhos mínimos (dist[x] = dist[w] + peso):
+ *    delta[w] = sigma[w] * soma((1 + delta[x]) / sigma[x]).
+ * Percorrer os sucessores pelas arestas de saída dispensa guardar listas de
+ * predecessores.
+ *
+ * Cada thread pega a próxima origem de um contador atômico (o custo por
+ * origem varia muito) e acumula em um vetor próprio; os vetores são somados
+ * no fim. No modo aproximado, k origens sorteadas são usadas e o resultado é
+ * multiplicado por V / k.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "IndiceCSR.hpp"
+#include "Paralelo.hpp"
+
+/**
+ * @struct EspacoBrandes
+ * @brief Vetores de trabalho de uma thread, reaproveitados entre origens.
+ */
+struct EspacoBrandes {
+    std::vector<long long> dist; ///< -1 para vértices não alcançados.
+    std::vector<double> sigma, delta;
+    std::vector<int> ordem; ///< Vértices na ordem em que foram fechados.
+    std::vector<int> fila;
+
+    explicit EspacoBrandes(int n) : dist(n, -1), sigma(n, 0), delta(n, 0) {}
+};
+
+/**
+ * @brief Soma em c as dependências de todos os vértices em relação à
+ * origem s.
+ *
+ * @param ponderado Se true usa Dijkstra com os pesos (que devem ser
+ * positivos); senão busca em largura.
+ */
+template <typename D>
+void acumularDependencias(const IndiceCSRT<D> &g, int s, bool ponderado,
+                          EspacoBrandes &e, double *c) {
+    e.ordem.clear();
+    e.dist[s] = 0;
+    e.sigma[s] = 1;
+
+    if (!ponderado) {
+        e.fila.clear();
+        e.fila.push_back(s);
+        for (std::size_t i = 0; i < e.fila.size(); i++) {
+            int w = e.fila[i];
+            e.ordem.push_back(w);
+            for (const tupla *t = g.inicioVizinhos(w); t != g.fimVizinhos(w);
+                 t++) {
+                int x = t->vertice;
+                if (e.dist[x] == -1) {
+                    e.dist[x] = e.dist[w] + 1;
+                    e.fila.push_back(x);
+                }
+                if (e.dist[x] == e.dist[w] + 1)
+                    e.sigma[x] += e.sigma[w];
+            }
+        }
+    } else {
+        typedef std::pair<long long, int> item;
+        std::priority_queue<item, std::vector<item>, std::greater<item>> heap;
+        heap.push({0, s});
+        while (!heap.empty()) {
+            item topo = heap.top();
+            heap.pop();
+            int w = topo.second;
+            // Entradas desatualizadas: cada distância final entra uma vez
+            if (topo.first != e.dist[w])
+                continue;
+            e.ordem.push_back(w);
+            for (const tupla *t = g.inicioVizinhos(w); t != g.fimVizinhos(w);
+                 t++) {
+                int x = t->vertice;
+                long long d = e.dist[w] + t->peso;
+                if (e.dist[x] == -1 || d < e.dist[x]) {
+                    e.dist[x] = d;
+                    e.sigma[x] = e.sigma[w];
+                    heap.push({d, x});
+                } else if (d == e.dist[x]) {
+                    e.sigma[x] += e.sigma[w];
+                }
+            }
+        }
+    }
+
+    for (int i = int(e.ordem.size()) - 1; i >= 0; i--) {
+        int w = e.ordem[i];
+        double soma = 0;
+        for (const tupla *t = g.inicioVizinhos(w); t != g.fimVizinhos(w);
+             t++) {
+            int x = t->vertice;
+            long long passo = ponderado ? t->peso : 1;
+            if (x != w && e.dist[x] == e.dist[w] + passo)
+                soma += (1 + e.delta[x]) / e.sigma[x];
+        }
+        e.delta[w] = e.sigma[w] * soma;
+        if (w != s)
+            c[w] += e.delta[w];
+    }
+
+    // Limpa apenas o que foi alcançado
+    for (int w : e.ordem) {
+        e.dist[w] = -1;
+        e.sigma[w] = 0;
+        e.delta[w] = 0;
+    }
+}
+
+/**
+ * @brief Sorteia k origens distintas entre os n vértices.
+ */
+inline std::vector<int> sortearOrigens(int n, int k, unsigned semente) {
+    std::vector<int> origens(n);
+    for (int i = 0; i < n; i++)
+        origens[i] = i;
+    std::mt19937 gerador(semente);
+    k = std::min(k, n);
+    // Fisher-Yates parcial: as k primeiras posições são a amostra
+    for (int i = 0; i < k; i++)
+        std::swap(origens[i], origens[i + gerador() % (n - i)]);
+    origens.resize(k);
+    return origens;
+}
+
+/**
+ * @brief Calcula a centralidade de intermediação de todos os vértices.
+ *
+ * @param g Índice de vizinhos de saída (simétrico se não direcionado).
+ * @param centralidade Vetor de saída (g.tamanho posições).
+ * @param direcionado Se false, cada par é contado uma única vez (o
+ * resultado é dividido por 2).
+ * @param ponderado Se true usa Dijkstra; os pesos devem ser positivos.
+ * @param amostras Quantidade de origens sorteadas; 0 (ou >= V) usa todas e
+ * dá o valor exato.
+ * @param semente Semente do sorteio das origens.
+ * @param threads Quantidade de threads (0 usa numeroThreads()).
+ */
+template <typename D>
+void centralidadeIntermediacao(const IndiceCSRT<D> &g, double *centralidade,
+                               bool direcionado, bool ponderado,
+                               int amostras = 0, unsigned semente = 1,
+                               int threads = 0) {
+    int n = g.tamanho;
+    std::fill(centralidade, centralidade + n, 0.0);
+    if (n == 0)
+        return;
+
+    std::vector<int> origens;
+    if (amostras > 0 && amostras < n) {
+        origens = sortearOrigens(n, amostras, semente);
+    } else {
+        origens.resize(n);
+        for (int i = 0; i < n; i++)
+            origens[i] = i;
+    }
+    int k = int(origens.size());
+
+    if (threads <= 0)
+        threads = numeroThreads();
+    int partes = std::max(1, std::min(threads, k));
+
+    std::vector<std::vector<double>> parciais(partes);
+    std::atomic<int> proxima{0};
+    paraCadaParte(partes, [&](int p) {
+        EspacoBrandes e(n);
+        std::vector<double> &local = parciais[p];
+        local.assign(n, 0.0);
+        for (int i = proxima++; i < k; i = proxima++)
+            acumularDependencias(g, origens[i], ponderado, e, local.data());
+    });
+
+    double escala = (direcionado ? 1.0 : 0.5) * n / k;
+    paraCadaParte(partes, [&](int p) {
+        int fim = (long long)n * (p + 1) / partes;
+        for (int v = (long long)n * p / partes; v < fim; v++) {
+            double soma = 0;
+            for (const std::vector<double> &local : parciais)
+                soma += local[v];
+            centralidade[v] = soma * escala;
+        }
+    });
+}
@@ -0,0 +1,242 @@
+/**
+ * @file Exportacao.hpp
+ * @brief Exportação do grafo para arquivo (lista de arestas, GraphViz DOT,
+ * CSV e CSR binário) com escrita bufferizada.
+ *
+ * Os números são formatados com std::to_chars direto em um buffer de 1 MB,
+ * que é esvaziado com write(2) no descritor de arquivo. Não há locale,
+ * sincronização nem flush por linha, como acontece com std::cout << e
+ * std::endl, então o custo fica dominado pela própria escrita no arquivo.
+ */
+
+#pragma once
+
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "IndiceCSR.hpp"
+
+/**
+ * @class EscritorBuffer
+ * @brief Acumula a saída em um buffer e a escreve em blocos grandes em um
+ * descritor de arquivo.
+ *
+ * Erros de escrita são guardados: as escritas seguintes são ignoradas e
+ * descarregar() retorna false.
+ */
+class EscritorBuffer {
+  private:
+    int fd;
+    char *buffer;
+    std::size_t capacidade, usado = 0;
+    bool erro = false;
+
+    /**
+     * @brief Escreve n bytes no descritor, repetindo em escritas parciais e
+     * interrupções por sinal. Uma escrita de 0 bytes conta como erro, para
+     * não repetir indefinidamente.
+     */
+    void escreverTudo(const char *dados, std::size_t n) {
+        while (n > 0 && !erro) {
+            ssize_t escritos = ::write(fd, dados, n);
+            if (escritos <= 0) {
+                if (escritos == 0 || errno != EINTR)
+                    erro = true;
+                continue;
+            }
+            dados += escritos;
+            n -= std::size_t(escritos);
+        }
+    }
+
+  public:
+    static constexpr std::size_t CAPACIDADE_PADRAO = 1 << 20;
+
+    /**
+     * @param fd Descritor de arquivo aberto para escrita (não é fechado).
+     * @param capacidade Tamanho do buffer, em bytes.
+     */
+    explicit EscritorBuffer(int fd, std::size_t capacidade = CAPACIDADE_PADRAO)
+        : fd(fd), buffer(new char[capacidade]), capacidade(capacidade) {}
+
+    EscritorBuffer(const EscritorBuffer &) = delete;
+    EscritorBuffer &operator=(const EscritorBuffer &) = delete;
+
+    ~EscritorBuffer() {
+        descarregar();
+        delete[] buffer;
+    }
+
+    /**
+     * @brief Escreve o conteúdo do buffer no descritor.
+     *
+     * @return false se alguma escrita falhou.
+     */
+    bool descarregar() {
+        escreverTudo(buffer, usado);
+        usado = 0;
+        return !erro;
+    }
+
+    void escrever(char c) {
+        if (usado == capacidade)
+            descarregar();
+        buffer[usado++] = c;
+    }
+
+    /**
+     * @brief Escreve n bytes. Blocos maiores que o buffer vão direto para o
+     * descritor, sem cópia.
+     */
+    void escrever(const char *dados, std::size_t n) {
+        if (usado + n > capacidade)
+            descarregar();
+        if (n >= capacidade) {
+            escreverTudo(dados, n);
+            return;
+        }
+        std::memcpy(buffer + usado, dados, n);
+        usado += n;
+    }
+
+    void escrever(const char *texto) { escrever(texto, std::strlen(texto)); }
+
+    /**
+     * @brief Escreve um inteiro em decimal.
+     */
+    void escreverInteiro(long long x) {
+        // 20 caracteres bastam para qualquer long long com sinal
+        if (capacidade - usado < 20)
+            descarregar();
+        char *fim = std::to_chars(buffer + usado, buffer + capacidade, x).ptr;
+        usado = std::size_t(fim - buffer);
+    }
+
+    bool temErro() const { return erro; }
+};
+
+/**
+ * @enum FormatoExportacao
+ * @brief Formatos aceitos por exportarGrafo.
+ */
+enum class FormatoExportacao {
+    LISTA_ARESTAS, ///< "u v [peso]" por linha.
+    DOT,           ///< GraphViz.
+    CSV,           ///< Cabeçalho "origem,destino[,peso]".
+    BINARIO        ///< Índice CSR cru (ver exportarGrafo).
+};
+
+/**
+ * @brief Escreve o grafo descrito pelo índice g no descritor fd.
+ *
+ * Nos formatos de texto, grafos não direcionados têm cada aresta escrita uma
+ * única vez (u <= v), e os vértices aparecem pelo rótulo quando `labels` não
+ * for nulo.
+ *
+ * O formato binário, na ordem dos bytes da máquina, é: "GRAFOCSR", int32
+ * versão (1), int32 flags (1 = direcionado, 2 = ponderado, 4 = rotulado),
+ * int32 V, int32 E, V + 1 int32 de deslocamentos, E pares int32 (vizinho,
+ * peso) e, se rotulado, V uint32 de rótulos. Índices com deslocamentos de 64
+ * bits usam a versão 2, em que E e os deslocamentos são int64.
+ *
+ * @param g Índice de saída do grafo (simétrico se não direcionado).
+ * @param fd Descritor aberto para escrita.
+ * @param labels Rótulos dos vértices, ou nullptr.
+ * @return false se alguma escrita falhou.
+ */
+template <typename D>
+bool exportarGrafo(const IndiceCSRT<D> &g, int fd, FormatoExportacao formato,
+                   bool direcionado, bool ponderado,
+                   const unsigned int *labels = nullptr) {
+    EscritorBuffer saida(fd);
+    auto nome = [&](int v) {
+        saida.escreverInteiro(labels ? (long long)labels[v] : v);
+    };
+
+    if (formato == FormatoExportacao::BINARIO) {
+        std::int32_t cabecalho[3] = {
+            sizeof(D) == 4 ? 1 : 2,
+            (direcionado ? 1 : 0) | (ponderado ? 2 : 0) | (labels ? 4 : 0),
+            g.tamanho};
+        D tArestas = g.tArestas;
+        saida.escrever("GRAFOCSR", 8);
+        saida.escrever(reinterpret_cast<const char *>(cabecalho),
+                       sizeof(cabecalho));
+        saida.escrever(reinterpret_cast<const char *>(&tArestas), sizeof(D));
+        saida.escrever(reinterpret_cast<const char *>(g.inicio),
+                       sizeof(D) * (std::size_t(g.tamanho) + 1));
+        saida.escrever(reinterpret_cast<const char *>(g.arestas),
+                       sizeof(tupla) * std::size_t(g.tArestas));
+        if (labels != nullptr)
+            saida.escrever(reinterpret_cast<const char *>(labels),
+                           sizeof(unsigned int) * std::size_t(g.tamanho));
+        return saida.descarregar();
+    }
+
+    const char *separador = formato == FormatoExportacao::CSV ? "," : " ";
+    if (formato == FormatoExportacao::DOT) {
+        saida.escrever(direcionado ? "digraph G {\n" : "graph G {\n");
+        separador = direcionado ? " -> " : " -- ";
+        // Declara todos os vértices, inclusive os isolados
+        for (int v = 0; v < g.tamanho; v++) {
+            saida.escrever("  ");
+            nome(v);
+            saida.escrever(";\n", 2);
+        }
+    } else if (formato == FormatoExportacao::CSV) {
+        saida.escrever(ponderado ? "origem,destino,peso\n"
+                                 : "origem,destino\n");
+    }
+    std::size_t tSeparador = std::strlen(separador);
+
+    for (int u = 0; u < g.tamanho; u++) {
+        for (const tupla *t = g.inicioVizinhos(u); t != g.fimVizinhos(u); t++) {
+            if (!direcionado && t->vertice < u)
+                continue;
+
+            if (formato == FormatoExportacao::DOT)
+                saida.escrever("  ", 2);
+            nome(u);
+            saida.escrever(separador, tSeparador);
+            nome(t->vertice);
+            if (ponderado) {
+                if (formato == FormatoExportacao::DOT) {
+                    saida.escrever(" [label=", 8);
+                    saida.escreverInteiro(t->peso);
+                    saida.escrever(']');
+                } else {
+                    saida.escrever(separador, tSeparador);
+                    saida.escreverInteiro(t->peso);
+                }
+            }
+            if (formato == FormatoExportacao::DOT)
+                saida.escrever(';');
+            saida.escrever('\n');
+        }
+    }
+
+    if (formato == FormatoExportacao::DOT)
+        saida.escrever("}\n", 2);
+    return saida.descarregar();
+}
+
+/**
+ * @brief Cria (ou trunca) o arquivo `caminho` e escreve o grafo nele.
+ *
+ * @return false se o arquivo não pôde ser aberto ou alguma escrita falhou.
+ */
+template <typename D>
+bool exportarGrafo(const IndiceCSRT<D> &g, const char *caminho,
+                   FormatoExportacao formato, bool direcionado, bool ponderado,
+                   const unsigned int *labels = nullptr) {
+    int fd = ::open(caminho, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        return false;
+    bool ok = exportarGrafo(g, fd, formato, direcionado, ponderado, labels);
+    return ::close(fd) == 0 && ok;
+}
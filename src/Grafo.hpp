@@ -1,8 +1,21 @@
 #pragma once
 
+#include <climits>
 #include <iostream>
 
+#include "Alcancabilidade.hpp"
+#include "ArvoreGeradora.hpp"
+#include "BuscaBidirecional.hpp"
+#include "BuscaMultipla.hpp"
+#include "CaminhosMinimos.hpp"
+#include "Centralidade.hpp"
+#include "Exportacao.hpp"
 #include "Implementacao.hpp"
+#include "Nucleos.hpp"
+#include "PageRank.hpp"
+#include "ParticaoNUMA.hpp"
+#include "Rotulos.hpp"
+#include "Triangulos.hpp"
 
 /**
  * @class Grafo
@@ -15,17 +28,13 @@
  * @private
  * - Implementacao *impl: Ponteiro para a implementação interna do grafo.
  * - bool rotulado: Indica se o grafo possui rótulos nos vértices.
- * - int tLabels: Quantidade atual de rótulos armazenados.
- * - int tLabelsMax: Capacidade máxima atual do vetor de rótulos.
- * - unsigned int* labels: Vetor dinâmico que armazena os rótulos dos vértices.
+ * - Rotulos<unsigned int> labels: Rótulos dos vértices, indexados pelo
+ * índice interno, com busca por hash (ver Rotulos.hpp). Para rótulos de
+ * outros tipos (texto, inteiros de 64 bits) use GrafoRotulado.
  *
  * @private
- * void realocarEspacoVetor(unsigned int **origem, int tamanhoOrigem, int
- * tamanhoFinal): Realoca o vetor de rótulos para um novo tamanho, copiando os 
- * ados existentes.
- *
  * int buscarLabel(int buscar):
- *     Busca o índice de um rótulo no vetor de rótulos.
+ *     Busca o índice de um rótulo em O(1) esperado.
  *
  * @public
  * Grafo(Implementacao *implementacao, bool rotulado):
@@ -39,7 +48,8 @@
  *     Exibe o grafo, utilizando os rótulos se o grafo for rotulado.
  *
  * bool adicionarVertice(unsigned int v):
- *     Adiciona um novo vértice ao grafo, atribuindo um rótulo se necessário.
+ *     Adiciona um novo vértice ao grafo, atribuindo um rótulo se necessário
+ * (rótulos repetidos são recusados).
  *
  * bool adicionarAresta(int u, int v, int p = 0):
  *     Adiciona uma aresta entre dois vértices, utilizando rótulos se o grafo f
@@ -53,29 +63,123 @@ class Grafo {
   private:
     Implementacao *impl;
     bool direcionado, ponderado, rotulado;
-    int tLabels = 0, tLabelsMax = 10;
-    unsigned int *labels = nullptr;
-
-    void realocarEspacoVetor(unsigned int **origem, int tamanhoOrigem,
-                             int tamanhoFinal) {
-        unsigned int *temp =
-            new unsigned int[tamanhoFinal]; // Criando vetor com o novo tamanho
-        std::copy(
-            *origem, *origem + tamanhoOrigem,
-            temp); // Copiando os dados do vetor de origem para o novo vetor
-        delete[] *origem; // Desalocando espaço do vetor de origem
-        *origem = temp;   // Apontando origem para o novo vetor
-    }
-
-    int buscarLabel(int buscar) {
-        int resp = -1;
-        for (int i = 0; i < tLabels; i++) {
-            if (labels[i] == buscar) {
-                resp = i;
-                i = tLabels;
+    Rotulos<unsigned int> labels;
+    EspacoBidirecional espacoBidirecional;
+
+    /**
+     * @brief Índice de alcançabilidade e a versão da implementação (ver
+     * Implementacao::getVersao) em que ele foi construído.
+     */
+    IndiceAlcancabilidade *alcancabilidade = nullptr;
+    unsigned long long versaoAlcancabilidade = 0;
+
+    /**
+     * @brief Índice de saída particionado por nó NUMA, com a sua equipe de
+     * threads, e a versão em que ele foi construído. Só um dos dois existe,
+     * conforme a largura do índice de saída.
+     */
+    CSRParticionado *particionado = nullptr;
+    CSRParticionado64 *particionado64 = nullptr;
+    unsigned long long versaoParticionado = 0;
+
+    /**
+     * @brief Chama f com o índice de saída: o de 32 bits ou, se as arestas
+     * não couberem em int, o de 64 bits (ver Implementacao::exportarCSR64).
+     * Os algoritmos são templates na largura dos deslocamentos.
+     *
+     * @return Resultado de f, ou erro se não houver índice.
+     */
+    template <typename R, typename F> R comIndiceSaida(R erro, F f) {
+        if (const IndiceCSR *g = impl->obterIndiceSaida())
+            return f(*g);
+        if (const IndiceCSR64 *g = impl->obterIndiceSaida64())
+            return f(*g);
+        return erro;
+    }
+
+    /**
+     * @brief Chama f com os índices de saída e de entrada, da mesma largura
+     * (ver comIndiceSaida). Em grafos não direcionados a entrada é a saída.
+     */
+    template <typename R, typename F> R comIndices(R erro, F f) {
+        if (const IndiceCSR *g = impl->obterIndiceSaida()) {
+            const IndiceCSR *e = direcionado ? impl->obterIndiceEntrada() : g;
+            return e == nullptr ? erro : f(*g, *e);
+        }
+        if (const IndiceCSR64 *g = impl->obterIndiceSaida64()) {
+            const IndiceCSR64 *e =
+                direcionado ? impl->obterIndiceEntrada64() : g;
+            return e == nullptr ? erro : f(*g, *e);
+        }
+        return erro;
+    }
+
+    /**
+     * @brief Chama f com o índice de saída particionado por nó NUMA (ver
+     * ParticaoNUMA.hpp), construindo-o na primeira chamada após uma
+     * modificação.
+     *
+     * @return Resultado de f, ou erro se não houver índice.
+     */
+    template <typename R, typename F> R comIndiceParticionado(R erro, F f) {
+        if (versaoParticionado != impl->getVersao()) {
+            delete particionado;
+            delete particionado64;
+            particionado = nullptr;
+            particionado64 = nullptr;
+        }
+        if (particionado == nullptr && particionado64 == nullptr) {
+            if (const IndiceCSR *g = impl->obterIndiceSaida())
+                particionado = new CSRParticionado(*g);
+            else if (const IndiceCSR64 *g = impl->obterIndiceSaida64())
+                particionado64 = new CSRParticionado64(*g);
+            versaoParticionado = impl->getVersao();
+        }
+        if (particionado != nullptr)
+            return f(*particionado);
+        if (particionado64 != nullptr)
+            return f(*particionado64);
+        return erro;
+    }
+
+    int buscarLabel(int buscar) { return labels.buscar(unsigned(buscar)); }
+
+    /**
+     * @brief Converte um vértice (rótulo ou índice) para o índice interno.
+     *
+     * @return Índice do vértice, ou -1 se ele não existir.
+     */
+    int indiceVertice(int v) {
+        if (rotulado)
+            return buscarLabel(v);
+        return (v >= 0 && v < impl->getTamanho()) ? v : -1;
+    }
+
+    /**
+     * @brief Converte os vértices de um lote para índices internos.
+     *
+     * Em grafos não direcionados o lote retornado tem 2n arestas: as n
+     * originais seguidas das n inversas.
+     *
+     * @return Novo lote, de responsabilidade do chamador, ou nullptr se algum
+     * vértice não existir.
+     */
+    tAresta *converterLote(const tAresta *lote, int n) {
+        tAresta *convertido = new tAresta[direcionado ? n : 2 * n];
+        for (int i = 0; i < n; i++) {
+            int iU = indiceVertice(lote[i].origem);
+            int iV = indiceVertice(lote[i].destino);
+            if (iU == -1 || iV == -1) {
+                delete[] convertido;
+                return nullptr;
             }
+
+            int p = ponderado ? lote[i].peso : 1;
+            convertido[i] = {iU, iV, p};
+            if (!direcionado)
+                convertido[n + i] = {iV, iU, p};
         }
-        return resp;
+        return convertido;
     }
 
   public:
@@ -83,8 +187,7 @@ class Grafo {
      * @brief Construtor da classe Grafo.
      *
      * Inicializa um novo objeto Grafo com a implementação fornecida e define se o
-     * grafo é rotulado. Caso o grafo seja rotulado, aloca espaço inicial para 
-     * s labels dos vértices.
+     * grafo é rotulado.
      *
      * @param implementacao Ponteiro para a implementação do grafo (ex: matriz d
      *  adjacência, lista, etc).
@@ -92,19 +195,20 @@ class Grafo {
      */
     Grafo(Implementacao *implementacao, bool direcionado, bool ponderado,
           bool rotulado)
-        : tLabels(0), tLabelsMax(10), impl(implementacao),
-          direcionado(direcionado), ponderado(ponderado), rotulado(rotulado) {
-        if (rotulado) {
-            labels = new unsigned int[tLabelsMax];
-        }
-    }
+        : impl(implementacao), direcionado(direcionado), ponderado(ponderado),
+          rotulado(rotulado) {}
 
     /**
      * @brief Destrutor da classe Grafo.
      *
      * Libera a memória alocada para a implementação do grafo.
      */
-    ~Grafo() { delete impl; }
+    ~Grafo() {
+        delete alcancabilidade;
+        delete particionado;
+        delete particionado64;
+        delete impl;
+    }
 
     /**
      * @brief Exibe o grafo.
@@ -114,7 +218,7 @@ class Grafo {
      */
     void mostrar() {
         if (rotulado) {
-            impl->mostrar(labels);
+            impl->mostrar(labels.dados());
         } else {
             impl->mostrar();
         }
@@ -124,27 +228,22 @@ class Grafo {
      * @brief Adiciona um novo vértice ao grafo.
      *
      * Caso o grafo seja rotulado, armazena o rótulo do novo vértice.
-     * Realoca o vetor de labels se necessário.
      *
      * @param v Rótulo do vértice a ser adicionado.
-     * @return true se o vértice foi adicionado com sucesso, false caso 
-     * ontrário.
+     * @return true se o vértice foi adicionado com sucesso, false caso
+     * contrário (inclusive se o rótulo já existir).
      */
     bool adicionarVertice(unsigned int v) {
+        if (rotulado && labels.buscar(v) != -1)
+            return false;
+
         int novo = impl->adicionarVertice();
 
         if (novo == -1)
             return false;
 
-        if (rotulado) {
-            if (tLabels == tLabelsMax) {
-                tLabelsMax += 10;
-                realocarEspacoVetor(&labels, tLabels, tLabelsMax);
-            }
-
-            labels[novo] = v;
-            tLabels++;
-        }
+        if (rotulado)
+            labels.adicionar(v);
 
         return true;
     }
@@ -181,6 +280,97 @@ class Grafo {
         return true;
     }
 
+    /**
+     * @brief Remove a aresta entre dois vértices.
+     *
+     * Em grafos não direcionados remove também a aresta inversa.
+     *
+     * @param u Índice ou rótulo do vértice de origem.
+     * @param v Índice ou rótulo do vértice de destino.
+     * @return true se a aresta existia e foi removida, false caso contrário.
+     */
+    bool removerAresta(int u, int v) {
+        int iU = indiceVertice(u), iV = indiceVertice(v);
+        if (iU == -1 || iV == -1)
+            return false;
+
+        bool resp = impl->removerAresta(iU, iV);
+
+        if (!direcionado && iU != iV)
+            impl->removerAresta(iV, iU);
+
+        return resp;
+    }
+
+    /**
+     * @brief Verifica se existe uma aresta de u para v.
+     *
+     * @param u Índice ou rótulo do vértice de origem.
+     * @param v Índice ou rótulo do vértice de destino.
+     */
+    bool existeAresta(int u, int v) {
+        int iU = indiceVertice(u), iV = indiceVertice(v);
+        if (iU == -1 || iV == -1)
+            return false;
+        return impl->existeAresta(iU, iV);
+    }
+
+    /**
+     * @brief Obtém o peso da aresta de u para v.
+     *
+     * @param u Índice ou rótulo do vértice de origem.
+     * @param v Índice ou rótulo do vértice de destino.
+     * @return Peso da aresta, ou -1 se ela (ou algum dos vértices) não
+     * existir.
+     */
+    int pesoAresta(int u, int v) {
+        int iU = indiceVertice(u), iV = indiceVertice(v);
+        if (iU == -1 || iV == -1)
+            return -1;
+        return impl->pesoAresta(iU, iV);
+    }
+
+    /**
+     * @brief Adiciona um lote de arestas de uma só vez.
+     *
+     * Os vértices do lote são índices ou rótulos, conforme o grafo. Em grafos
+     * não direcionados as arestas inversas entram no mesmo lote.
+     *
+     * @param lote Vetor de arestas a serem adicionadas.
+     * @param n Quantidade de arestas no lote.
+     * @return false se algum vértice não existir (nesse caso nada é
+     * adicionado), true caso contrário.
+     */
+    bool adicionarArestas(const tAresta *lote, int n) {
+        tAresta *convertido = converterLote(lote, n);
+        if (convertido == nullptr)
+            return false;
+
+        bool resp = impl->adicionarArestas(convertido, direcionado ? n : 2 * n);
+        delete[] convertido;
+        return resp;
+    }
+
+    /**
+     * @brief Remove um lote de arestas de uma só vez.
+     *
+     * @param lote Vetor de arestas a serem removidas (o peso é ignorado).
+     * @param n Quantidade de arestas no lote.
+     * @return Quantidade de arestas removidas, ou -1 se algum vértice não
+     * existir.
+     */
+    int removerArestas(const tAresta *lote, int n) {
+        tAresta *convertido = converterLote(lote, n);
+        if (convertido == nullptr)
+            return -1;
+
+        int removidas = impl->removerArestas(convertido, n);
+        if (!direcionado)
+            impl->removerArestas(convertido + n, n);
+        delete[] convertido;
+        return removidas;
+    }
+
     /**
      * @brief Retorna o número de vértices do grafo.
      *
@@ -188,8 +378,38 @@ class Grafo {
      */
     int getTamanho() { return impl->getTamanho(); }
 
+    /**
+     * @brief Indica se o grafo é direcionado.
+     */
+    bool isDirecionado() { return direcionado; }
+
+    /**
+     * @brief Indica se o grafo é ponderado.
+     */
+    bool isPonderado() { return ponderado; }
+
+    /**
+     * @brief Indica se os vértices são identificados por rótulos.
+     */
+    bool isRotulado() { return rotulado; }
+
+    /**
+     * @brief Converte um vértice (rótulo ou índice) para o índice interno.
+     *
+     * @return Índice do vértice, ou -1 se ele não existir.
+     */
+    int getIndice(int v) { return indiceVertice(v); }
+
+    /**
+     * @brief Retorna o vetor de rótulos, indexado pelo índice interno dos
+     * vértices, ou nullptr se o grafo não for rotulado.
+     */
+    const unsigned int *getLabels() {
+        return rotulado ? labels.dados() : nullptr;
+    }
+
     void print() {
-        for (int i = 0; i < tLabels; i++)
+        for (int i = 0; i < labels.getTamanho(); i++)
             std::cout << labels[i] << " ";
     }
 
@@ -218,4 +438,483 @@ class Grafo {
     }
 
     std::size_t getMemoriaOcupada() { return impl->getMemoriaOcupada(); }
+
+    /**
+     * @brief Encontra um caminho com o menor número de arestas de s até t.
+     *
+     * Usa busca em largura bidirecional: pelos vizinhos de saída a partir de
+     * s e pelos de entrada a partir de t, expandindo sempre a menor fronteira.
+     *
+     * @param s Índice ou rótulo do vértice de origem.
+     * @param t Índice ou rótulo do vértice de destino.
+     * @param caminho Recebe os vértices do caminho (rótulos se o grafo for
+     * rotulado), de s até t.
+     * @return Quantidade de arestas do caminho, ou -1 se t não for alcançável
+     * a partir de s, algum dos vértices não existir ou não houver índice CSR
+     * (ver comIndiceSaida).
+     */
+    int caminho(int s, int t, std::vector<int> &caminho) {
+        caminho.clear();
+        int iS = indiceVertice(s), iT = indiceVertice(t);
+        if (iS == -1 || iT == -1)
+            return -1;
+
+        int d = comIndices(-1, [&](const auto &saida, const auto &entrada) {
+            return buscaBidirecional(saida, entrada, iS, iT,
+                                     espacoBidirecional, caminho);
+        });
+        if (rotulado)
+            for (int &v : caminho)
+                v = labels[v];
+        return d;
+    }
+
+    /**
+     * @brief Verifica se existe caminho de u até v.
+     *
+     * A primeira chamada após uma modificação constrói o índice de
+     * alcançabilidade; as seguintes respondem sem percorrer o grafo.
+     *
+     * @param u Índice ou rótulo do vértice de origem.
+     * @param v Índice ou rótulo do vértice de destino.
+     * @return true se v é alcançável a partir de u; false também se não
+     * houver índice CSR (ver comIndiceSaida).
+     */
+    bool alcanca(int u, int v) {
+        int iU = indiceVertice(u), iV = indiceVertice(v);
+        if (iU == -1 || iV == -1)
+            return false;
+        const IndiceAlcancabilidade *indice = obterIndiceAlcancabilidade();
+        return indice != nullptr && indice->alcanca(iU, iV);
+    }
+
+    /**
+     * @brief Executa buscas em largura a partir de várias origens de uma vez.
+     *
+     * As buscas compartilham cada leitura de lista de vizinhos (MS-BFS), o que
+     * é muito mais rápido que chamar caminhamentoEmLargura para cada origem.
+     *
+     * @param origens Índices ou rótulos dos vértices de origem.
+     * @param k Quantidade de origens.
+     * @param distancias Matriz k x getTamanho(); a posição [i * getTamanho()
+     * + w] recebe a distância de origens[i] até o vértice de índice interno w,
+     * ou -1 se w não for alcançável.
+     * @return false se alguma origem não existir ou não houver índice CSR
+     * (ver comIndiceSaida), true caso contrário.
+     */
+    bool caminhamentoEmLarguraMultiplo(const int *origens, int k,
+                                       int *distancias) {
+        int *indices = new int[k];
+        for (int i = 0; i < k; i++) {
+            indices[i] = indiceVertice(origens[i]);
+            if (indices[i] == -1) {
+                delete[] indices;
+                return false;
+            }
+        }
+
+        bool resp = comIndiceSaida(false, [&](const auto &g) {
+            buscaEmLarguraMultipla(g, indices, k, distancias);
+            return true;
+        });
+        delete[] indices;
+        return resp;
+    }
+
+    /**
+     * @brief Calcula o PageRank de todos os vértices.
+     *
+     * @param rank Vetor com getTamanho() posições, indexado pelo índice
+     * interno dos vértices.
+     * @param puxar Se true soma os vizinhos de entrada (pull); senão distribui
+     * para os vizinhos de saída (push).
+     * @param tolerancia Critério de parada pela norma L1 da variação.
+     * @param maxIteracoes Limite de iterações.
+     * @return Quantidade de iterações executadas, ou -1 se não houver índice
+     * CSR (ver comIndiceSaida).
+     */
+    int pageRank(double *rank, bool puxar = true, double tolerancia = 1e-6,
+                 int maxIteracoes = 100) {
+        if (!puxar)
+            return comIndiceSaida(-1, [&](const auto &saida) {
+                return ::pageRank(saida, saida, rank, puxar, 0.85, tolerancia,
+                                  maxIteracoes);
+            });
+        return comIndices(-1, [&](const auto &saida, const auto &entrada) {
+            return ::pageRank(saida, entrada, rank, puxar, 0.85, tolerancia,
+                              maxIteracoes);
+        });
+    }
+
+    /**
+     * @brief Calcula as distâncias a partir de v com a busca em largura sobre
+     * o índice particionado por nó NUMA (ver ParticaoNUMA.hpp).
+     *
+     * O índice particionado e a sua equipe de threads fixadas são
+     * construídos na primeira chamada após uma modificação e reaproveitados
+     * nas seguintes.
+     *
+     * @param v Índice ou rótulo do vértice de origem.
+     * @param dist Vetor com getTamanho() posições, indexado pelo índice
+     * interno; recebe a distância (em arestas) a partir de v, ou -1 se
+     * inalcançável. Para que cada parte fique no nó da thread que a escreve,
+     * dist deve ser memória ainda não tocada.
+     * @return Quantidade de vértices alcançados, ou -1 se v não existir ou
+     * não houver índice CSR (ver comIndiceSaida).
+     */
+    int caminhamentoEmLarguraNUMA(int v, int *dist) {
+        int indiceV = indiceVertice(v);
+        if (indiceV == -1)
+            return -1;
+        return comIndiceParticionado(-1, [&](const auto &g) {
+            return buscaEmLarguraParticionada(g, indiceV, dist);
+        });
+    }
+
+    /**
+     * @brief Calcula o PageRank (variante push) sobre o índice particionado
+     * por nó NUMA (ver ParticaoNUMA.hpp).
+     *
+     * @param rank Vetor com getTamanho() posições, indexado pelo índice
+     * interno dos vértices.
+     * @param tolerancia Critério de parada pela norma L1 da variação.
+     * @param maxIteracoes Limite de iterações.
+     * @return Quantidade de iterações executadas, ou -1 se não houver índice
+     * CSR (ver comIndiceSaida).
+     */
+    int pageRankNUMA(double *rank, double tolerancia = 1e-6,
+                     int maxIteracoes = 100) {
+        return comIndiceParticionado(-1, [&](const auto &g) {
+            return pageRankParticionado(g, rank, 0.85, tolerancia,
+                                        maxIteracoes);
+        });
+    }
+
+    /**
+     * @brief Conta os triângulos de um grafo não direcionado.
+     *
+     * Representações densas usam linhas de bits (AND + popcount); as demais,
+     * interseção de listas ordenadas com arestas orientadas por grau.
+     *
+     * @param porVertice Se diferente de nullptr, recebe (getTamanho()
+     * posições) os triângulos de que cada vértice participa.
+     * @return Quantidade de triângulos, ou -1 se o grafo for direcionado ou
+     * não houver índice CSR (ver comIndiceSaida).
+     */
+    long long contarTriangulos(long long *porVertice = nullptr) {
+        if (direcionado)
+            return -1;
+        return comIndiceSaida(-1LL, [&](const auto &g) {
+            if (!impl->isDensa())
+                return ::contarTriangulos(g, porVertice);
+
+            MatrizBits m(g.tamanho, g.tamanho);
+            for (int u = 0; u < g.tamanho; u++)
+                for (const tupla *t = g.inicioVizinhos(u);
+                     t != g.fimVizinhos(u); t++)
+                    if (t->vertice != u)
+                        m.ligar(u, t->vertice);
+            return contarTriangulosDenso(m, porVertice);
+        });
+    }
+
+    /**
+     * @brief Calcula o coeficiente de agrupamento local de cada vértice de um
+     * grafo não direcionado.
+     *
+     * @param coeficientes Vetor com getTamanho() posições, indexado pelo
+     * índice interno dos vértices.
+     * @return false se o grafo for direcionado ou não houver índice CSR (ver
+     * comIndiceSaida), true caso contrário.
+     */
+    bool coeficientesAgrupamento(double *coeficientes) {
+        if (direcionado)
+            return false;
+        return comIndiceSaida(false, [&](const auto &g) {
+            int n = g.tamanho;
+            long long *triangulos = new long long[n];
+            int *graus = new int[n];
+            contarTriangulos(triangulos);
+            for (int v = 0; v < n; v++) {
+                graus[v] = int(g.grau(v));
+                for (const tupla *t = g.inicioVizinhos(v);
+                     t != g.fimVizinhos(v); t++)
+                    if (t->vertice == v)
+                        graus[v]--;
+            }
+
+            ::coeficientesAgrupamento(triangulos, graus, n, coeficientes);
+            delete[] triangulos;
+            delete[] graus;
+            return true;
+        });
+    }
+
+    /**
+     * @brief Calcula o número de núcleo (k-core) de cada vértice de um grafo
+     * não direcionado, junto com uma ordenação de degenerescência.
+     *
+     * Os graus iniciais vêm do índice CSR de saída (diferença entre
+     * deslocamentos consecutivos).
+     *
+     * @param nucleo Vetor com getTamanho() posições, indexado pelo índice
+     * interno dos vértices.
+     * @param ordem Se diferente de nullptr, recebe (getTamanho() posições) os
+     * vértices na ordem de remoção (rótulos se o grafo for rotulado).
+     * @param paralelo Se true remove os vértices de cada nível em paralelo;
+     * senão usa o algoritmo linear de Batagelj-Zaversnik.
+     * @return Degenerescência (maior número de núcleo), ou -1 se o grafo for
+     * direcionado ou não houver índice CSR (ver comIndiceSaida).
+     */
+    int nucleos(int *nucleo, int *ordem = nullptr, bool paralelo = false) {
+        if (direcionado)
+            return -1;
+
+        int degenerescencia = comIndiceSaida(-1, [&](const auto &g) {
+            return paralelo ? nucleosParalelo(g, nucleo, ordem)
+                            : nucleosSequencial(g, nucleo, ordem);
+        });
+        if (degenerescencia != -1 && rotulado && ordem != nullptr)
+            for (int i = 0; i < impl->getTamanho(); i++)
+                ordem[i] = int(labels[ordem[i]]);
+        return degenerescencia;
+    }
+
+    /**
+     * @brief Calcula a centralidade de intermediação (betweenness) de todos
+     * os vértices pelo algoritmo de Brandes, em paralelo.
+     *
+     * Grafos ponderados usam Dijkstra e exigem pesos positivos; os demais
+     * usam busca em largura.
+     *
+     * @param centralidade Vetor com getTamanho() posições, indexado pelo
+     * índice interno dos vértices.
+     * @param amostras Quantidade de origens sorteadas para uma estimativa
+     * (0 calcula o valor exato, a partir de todas as origens).
+     * @param semente Semente do sorteio das origens.
+     * @return false se o grafo for ponderado e tiver algum peso menor ou
+     * igual a zero, ou se não houver índice CSR (ver comIndiceSaida).
+     */
+    bool centralidadeIntermediacao(double *centralidade, int amostras = 0,
+                                   unsigned semente = 1) {
+        return comIndiceSaida(false, [&](const auto &g) {
+            if (ponderado)
+                for (const tupla *t = g.arestas; t != g.arestas + g.tArestas;
+                     t++)
+                    if (t->peso <= 0)
+                        return false;
+
+            ::centralidadeIntermediacao(g, centralidade, direcionado,
+                                        ponderado, amostras, semente);
+            return true;
+        });
+    }
+
+    /**
+     * @brief Calcula a floresta geradora mínima de um grafo não direcionado.
+     *
+     * @param floresta Recebe as arestas escolhidas, com rótulos se o grafo
+     * for rotulado.
+     * @param usarBoruvka Se true usa Borůvka paralelo; senão Kruskal com
+     * ordenação radix paralela.
+     * @return Soma dos pesos da floresta, ou -1 se o grafo for direcionado,
+     * não houver índice CSR (ver comIndiceSaida) ou houver mais de INT_MAX
+     * arestas u - v.
+     */
+    long long arvoreGeradoraMinima(std::vector<tAresta> &floresta,
+                                   bool usarBoruvka = true) {
+        if (direcionado)
+            return -1;
+
+        long long total = comIndiceSaida(-1LL, [&](const auto &g) {
+            if (g.tArestas / 2 > INT_MAX)
+                return -1LL;
+            return usarBoruvka ? boruvka(g, floresta) : kruskal(g, floresta);
+        });
+        if (total != -1 && rotulado) {
+            for (tAresta &a : floresta) {
+                a.origem = labels[a.origem];
+                a.destino = labels[a.destino];
+            }
+        }
+        return total;
+    }
+
+    /**
+     * @brief Calcula a distância mínima entre todos os pares de vértices.
+     *
+     * Usa Floyd-Warshall em blocos, paralelo, sobre uma cópia contígua dos
+     * pesos. Indicado para grafos de até alguns milhares de vértices.
+     *
+     * @param distancias Matriz getTamanho() x getTamanho(); a posição [u *
+     * getTamanho() + v] recebe a distância do vértice de índice interno u até
+     * o de índice v, ou INFINITO se não houver caminho.
+     * @return false se não houver índice CSR (ver comIndiceSaida).
+     */
+    bool caminhosMinimosTodosPares(int *distancias) {
+        int n = impl->getTamanho();
+        int largura = larguraBlocada(n);
+        int *dist = new int[(std::size_t)largura * largura];
+
+        std::fill(dist, dist + (std::size_t)largura * largura, INFINITO);
+        if (!impl->exportarPesos(dist, largura, INFINITO)) {
+            delete[] dist;
+            return false;
+        }
+        // Pesos fora de [-INFINITO, INFINITO] fariam a soma min-plus
+        // estourar um int.
+        for (int u = 0; u < n; u++) {
+            int *linha = dist + (std::size_t)u * largura;
+            for (int v = 0; v < n; v++)
+                linha[v] = std::max(std::min(linha[v], INFINITO), -INFINITO);
+        }
+        for (int v = 0; v < largura; v++) {
+            int &d = dist[(std::size_t)v * largura + v];
+            d = std::min(d, 0);
+        }
+
+        floydWarshallBlocado(dist, largura);
+
+        for (int u = 0; u < n; u++) {
+            for (int v = 0; v < n; v++) {
+                int d = dist[(std::size_t)u * largura + v];
+                distancias[(std::size_t)u * n + v] =
+                    d > INFINITO / 2 ? INFINITO : d;
+            }
+        }
+        delete[] dist;
+        return true;
+    }
+
+    /**
+     * @brief Obtém o índice CSR de vizinhos de saída do grafo.
+     *
+     * O índice é reaproveitado até a próxima modificação do grafo. Retorna
+     * nullptr se as arestas não couberem em deslocamentos int (mais de
+     * 2^31 - 1 arestas em uma ListaAdjacencia64); nesse caso use
+     * obterIndiceSaida64. Os algoritmos do Grafo escolhem sozinhos.
+     */
+    const IndiceCSR *obterIndiceSaida() { return impl->obterIndiceSaida(); }
+
+    /**
+     * @brief Obtém o índice CSR de vizinhos de saída com deslocamentos de 64
+     * bits, ou nullptr se a representação não o fornecer (só a
+     * ListaAdjacencia64 fornece).
+     */
+    const IndiceCSR64 *obterIndiceSaida64() {
+        return impl->obterIndiceSaida64();
+    }
+
+    /**
+     * @brief Obtém o índice de alcançabilidade do grafo, construindo-o na
+     * primeira chamada após uma modificação.
+     */
+    const IndiceAlcancabilidade *obterIndiceAlcancabilidade() {
+        if (alcancabilidade != nullptr &&
+            versaoAlcancabilidade != impl->getVersao()) {
+            delete alcancabilidade;
+            alcancabilidade = nullptr;
+        }
+        if (alcancabilidade == nullptr) {
+            alcancabilidade = comIndiceSaida(
+                (IndiceAlcancabilidade *)nullptr,
+                [](const auto &g) { return new IndiceAlcancabilidade(g); });
+            versaoAlcancabilidade = impl->getVersao();
+        }
+        return alcancabilidade;
+    }
+
+    /**
+     * @brief Gera uma cópia independente das adjacências em formato CSR.
+     *
+     * Diferente de obterIndiceSaida, o índice retornado pertence ao chamador e
+     * continua válido após modificações no grafo.
+     *
+     * @param transposto Se true, exporta os vizinhos de entrada.
+     */
+    IndiceCSR *exportarCSR(bool transposto) {
+        return impl->exportarCSR(transposto && direcionado);
+    }
+
+    /**
+     * @brief Obtém o índice CSR de vizinhos de entrada do grafo.
+     *
+     * Em grafos direcionados o índice transposto é construído uma única vez e
+     * reaproveitado até a próxima modificação. Em grafos não direcionados os
+     * vizinhos de entrada coincidem com os de saída e nenhum índice extra é
+     * criado.
+     */
+    const IndiceCSR *obterIndiceEntrada() {
+        return direcionado ? impl->obterIndiceEntrada()
+                           : impl->obterIndiceSaida();
+    }
+
+    /**
+     * @brief Retorna o número de arestas que chegam ao vértice v.
+     *
+     * @param v Índice ou rótulo do vértice.
+     * @return Grau de entrada, ou -1 se o vértice não existir ou não houver
+     * índice CSR (ver comIndiceSaida).
+     */
+    int grauEntrada(int v) {
+        int indiceV = indiceVertice(v);
+        if (indiceV == -1)
+            return -1;
+        return comIndices(-1, [&](const auto &, const auto &entrada) {
+            return int(entrada.grau(indiceV));
+        });
+    }
+
+    /**
+     * @brief Copia os vizinhos de entrada do vértice v para destino.
+     *
+     * Os vizinhos são escritos como rótulos se o grafo for rotulado.
+     *
+     * @param v Índice ou rótulo do vértice.
+     * @param destino Vetor com pelo menos grauEntrada(v) posições.
+     * @return Quantidade de vizinhos copiados, ou -1 se o vértice não existir
+     * ou não houver índice CSR (ver comIndiceSaida).
+     */
+    int vizinhosEntrada(int v, int *destino) {
+        int indiceV = indiceVertice(v);
+        if (indiceV == -1)
+            return -1;
+
+        return comIndices(-1, [&](const auto &, const auto &entrada) {
+            int n = 0;
+            for (const tupla *t = entrada.inicioVizinhos(indiceV);
+                 t != entrada.fimVizinhos(indiceV); t++)
+                destino[n++] = rotulado ? labels[t->vertice] : t->vertice;
+            return n;
+        });
+    }
+
+    /**
+     * @brief Escreve o grafo em um descritor de arquivo, com escrita
+     * bufferizada (ver Exportacao.hpp).
+     *
+     * @param fd Descritor aberto para escrita (não é fechado).
+     * @param formato Lista de arestas, DOT, CSV ou CSR binário.
+     * @return false se alguma escrita falhou ou não houver índice CSR (ver
+     * comIndiceSaida).
+     */
+    bool exportar(int fd, FormatoExportacao formato) {
+        return comIndiceSaida(false, [&](const auto &g) {
+            return exportarGrafo(g, fd, formato, direcionado, ponderado,
+                                 getLabels());
+        });
+    }
+
+    /**
+     * @brief Escreve o grafo no arquivo `caminho`, criando-o ou truncando-o.
+     *
+     * @return false se o arquivo não pôde ser aberto, alguma escrita falhou
+     * ou não houver índice CSR (ver comIndiceSaida).
+     */
+    bool exportar(const char *caminho, FormatoExportacao formato) {
+        return comIndiceSaida(false, [&](const auto &g) {
+            return exportarGrafo(g, caminho, formato, direcionado, ponderado,
+                                 getLabels());
+        });
+    }
 };
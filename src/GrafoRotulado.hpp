@@ -0,0 +1,146 @@
+/**
+ * @file GrafoRotulado.hpp
+ * @brief Grafo cujos vértices são identificados por chaves de qualquer tipo
+ * com hash (texto, inteiros de 64 bits, ...).
+ *
+ * As chaves são convertidas para índices internos por Rotulos (com arena
+ * contígua no caso de std::string), e as operações são repassadas a um Grafo
+ * não rotulado. Assim os algoritmos continuam trabalhando só com índices, e
+ * as chaves são consultadas apenas na entrada e na saída.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "Grafo.hpp"
+#include "Rotulos.hpp"
+
+/**
+ * @class GrafoRotulado
+ * @brief Grafo com vértices identificados por chaves do tipo Chave.
+ *
+ * @tparam Chave Tipo do rótulo; precisa de std::hash e operator==.
+ */
+template <typename Chave> class GrafoRotulado {
+  private:
+    Grafo grafo;
+    Rotulos<Chave> rotulos;
+
+  public:
+    /**
+     * @param implementacao Representação usada pelo grafo (passa a ser do
+     * GrafoRotulado).
+     */
+    GrafoRotulado(Implementacao *implementacao, bool direcionado,
+                  bool ponderado)
+        : grafo(implementacao, direcionado, ponderado, false) {}
+
+    GrafoRotulado(const GrafoRotulado &) = delete;
+    GrafoRotulado &operator=(const GrafoRotulado &) = delete;
+
+    /**
+     * @brief Adiciona um vértice com a chave informada.
+     *
+     * @return false se a chave já existir.
+     */
+    bool adicionarVertice(const Chave &chave) {
+        if (rotulos.buscar(chave) != -1)
+            return false;
+        if (!grafo.adicionarVertice(0))
+            return false;
+        rotulos.adicionar(chave);
+        return true;
+    }
+
+    /**
+     * @brief Adiciona a aresta de u para v (e a inversa, se não
+     * direcionado).
+     *
+     * @return false se algum dos vértices não existir.
+     */
+    bool adicionarAresta(const Chave &u, const Chave &v, unsigned int p = 0) {
+        int iU = rotulos.buscar(u), iV = rotulos.buscar(v);
+        if (iU == -1 || iV == -1)
+            return false;
+        return grafo.adicionarAresta(iU, iV, p);
+    }
+
+    bool removerAresta(const Chave &u, const Chave &v) {
+        int iU = rotulos.buscar(u), iV = rotulos.buscar(v);
+        if (iU == -1 || iV == -1)
+            return false;
+        return grafo.removerAresta(iU, iV);
+    }
+
+    bool existeAresta(const Chave &u, const Chave &v) {
+        int iU = rotulos.buscar(u), iV = rotulos.buscar(v);
+        if (iU == -1 || iV == -1)
+            return false;
+        return grafo.existeAresta(iU, iV);
+    }
+
+    /**
+     * @return Peso da aresta, ou -1 se ela (ou algum vértice) não existir.
+     */
+    int pesoAresta(const Chave &u, const Chave &v) {
+        int iU = rotulos.buscar(u), iV = rotulos.buscar(v);
+        if (iU == -1 || iV == -1)
+            return -1;
+        return grafo.pesoAresta(iU, iV);
+    }
+
+    /**
+     * @brief Verifica se existe caminho de u até v (ver Grafo::alcanca).
+     */
+    bool alcanca(const Chave &u, const Chave &v) {
+        int iU = rotulos.buscar(u), iV = rotulos.buscar(v);
+        if (iU == -1 || iV == -1)
+            return false;
+        return grafo.alcanca(iU, iV);
+    }
+
+    /**
+     * @brief Encontra um caminho com o menor número de arestas de s até t.
+     *
+     * @param caminho Recebe as chaves dos vértices do caminho, de s até t.
+     * @return Quantidade de arestas do caminho, ou -1 se não houver caminho
+     * ou algum dos vértices não existir.
+     */
+    int caminho(const Chave &s, const Chave &t, std::vector<Chave> &caminho) {
+        caminho.clear();
+        int iS = rotulos.buscar(s), iT = rotulos.buscar(t);
+        if (iS == -1 || iT == -1)
+            return -1;
+
+        std::vector<int> indices;
+        int d = grafo.caminho(iS, iT, indices);
+        caminho.reserve(indices.size());
+        for (int v : indices)
+            caminho.push_back(getRotulo(v));
+        return d;
+    }
+
+    /**
+     * @brief Retorna o índice interno da chave, ou -1 se ela não existir.
+     */
+    int indice(const Chave &chave) const { return rotulos.buscar(chave); }
+
+    /**
+     * @brief Retorna a chave do vértice de índice interno i.
+     */
+    Chave getRotulo(int i) const { return Chave(rotulos[i]); }
+
+    int getTamanho() { return grafo.getTamanho(); }
+
+    /**
+     * @brief Grafo indexado por índices internos, para os demais algoritmos.
+     */
+    Grafo &getGrafo() { return grafo; }
+
+    const Rotulos<Chave> &getRotulos() const { return rotulos; }
+
+    std::size_t getMemoriaOcupada() {
+        return grafo.getMemoriaOcupada() + rotulos.getMemoriaOcupada();
+    }
+};
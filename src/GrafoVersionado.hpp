@@ -0,0 +1,283 @@
+/**
+ * @file GrafoVersionado.hpp
+ * @brief Isolamento por versões (snapshots) para consultas concorrentes com
+ * atualizações.
+ *
+ * Funcionamento:
+ * - As escritas são aplicadas sobre um Grafo mutável, protegido por um mutex.
+ * - Após um lote de escritas, `publicar` gera uma versão imutável (índices CSR
+ *   e rótulos) e a troca atomicamente pela versão atual.
+ * - Leitores obtêm a versão atual sem bloqueio e a usam até terminar. Uma
+ *   versão antiga só é liberada quando nenhum leitor que possa enxergá-la
+ *   continua ativo (recuperação baseada em épocas).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "Grafo.hpp"
+
+/**
+ * @struct Versao
+ * @brief Estado imutável do grafo em um instante.
+ *
+ * Campos:
+ * - numero: número sequencial da versão.
+ * - saida: índice de vizinhos de saída.
+ * - entrada: índice de vizinhos de entrada (nullptr se não solicitado).
+ * - labels: cópia dos rótulos (nullptr se o grafo não for rotulado).
+ */
+struct Versao {
+    std::uint64_t numero = 0;
+    IndiceCSR *saida = nullptr;
+    IndiceCSR *entrada = nullptr;
+    unsigned int *labels = nullptr;
+
+    Versao() = default;
+    Versao(const Versao &) = delete;
+    Versao &operator=(const Versao &) = delete;
+
+    ~Versao() {
+        delete saida;
+        delete entrada;
+        delete[] labels;
+    }
+};
+
+class GrafoVersionado {
+  public:
+    /**
+     * @brief Quantidade máxima de threads leitoras registradas ao mesmo tempo.
+     */
+    static const int MAX_LEITORES = 64;
+
+  private:
+    /**
+     * @brief Versão retirada, aguardando que nenhum leitor possa usá-la.
+     */
+    struct Retirada {
+        Versao *versao;
+        std::uint64_t epoca;
+    };
+
+    /**
+     * @brief Posição de um leitor. Cada uma ocupa sua própria linha de cache
+     * para que os leitores não disputem a mesma linha.
+     */
+    struct alignas(64) PosicaoLeitor {
+        std::atomic<bool> ocupada{false};
+        std::atomic<std::uint64_t> epoca{0}; ///< 0 indica fora de leitura.
+    };
+
+    Grafo *grafo;
+    bool comEntrada;
+
+    std::mutex escrita;
+    std::atomic<Versao *> atual{nullptr};
+    std::atomic<std::uint64_t> epocaGlobal{1};
+    PosicaoLeitor leitores[MAX_LEITORES];
+    std::vector<Retirada> retiradas;
+
+    /**
+     * @brief Gera uma versão imutável a partir do estado atual do grafo.
+     *
+     * @return Nova versão, ou nullptr se as arestas não couberem em um
+     * IndiceCSR (ver Grafo::obterIndiceSaida).
+     */
+    Versao *gerarVersao(std::uint64_t numero) {
+        Versao *versao = new Versao();
+        versao->numero = numero;
+        versao->saida = grafo->exportarCSR(false);
+        if (comEntrada)
+            versao->entrada = grafo->exportarCSR(true);
+        if (versao->saida == nullptr ||
+            (comEntrada && versao->entrada == nullptr)) {
+            delete versao;
+            return nullptr;
+        }
+
+        const unsigned int *labels = grafo->getLabels();
+        if (labels != nullptr) {
+            int n = grafo->getTamanho();
+            versao->labels = new unsigned int[n];
+            std::copy(labels, labels + n, versao->labels);
+        }
+        return versao;
+    }
+
+    /**
+     * @brief Libera as versões retiradas que nenhum leitor ativo pode estar
+     * usando: todo leitor ativo entrou em uma época posterior à retirada.
+     */
+    void recolher() {
+        std::uint64_t menor = UINT64_MAX;
+        for (int i = 0; i < MAX_LEITORES; i++) {
+            std::uint64_t e = leitores[i].epoca.load();
+            if (e != 0 && e < menor)
+                menor = e;
+        }
+
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < retiradas.size(); i++) {
+            if (retiradas[i].epoca < menor)
+                delete retiradas[i].versao;
+            else
+                retiradas[n++] = retiradas[i];
+        }
+        retiradas.resize(n);
+    }
+
+  public:
+    /**
+     * @class Leitura
+     * @brief Acesso a uma versão do grafo durante o tempo de vida do objeto.
+     *
+     * A versão obtida não é alterada nem liberada enquanto a leitura existir,
+     * mesmo que novas versões sejam publicadas.
+     */
+    class Leitura {
+      private:
+        GrafoVersionado *origem;
+        int posicao;
+        const Versao *versao;
+
+      public:
+        /**
+         * @param origem Grafo versionado a ser lido.
+         * @param posicao Posição obtida com registrarLeitor.
+         */
+        Leitura(GrafoVersionado &origem, int posicao)
+            : origem(&origem), posicao(posicao) {
+            std::atomic<std::uint64_t> &epoca =
+                origem.leitores[posicao].epoca;
+            epoca.store(origem.epocaGlobal.load());
+            versao = origem.atual.load();
+        }
+
+        Leitura(const Leitura &) = delete;
+        Leitura &operator=(const Leitura &) = delete;
+
+        ~Leitura() { origem->leitores[posicao].epoca.store(0); }
+
+        const Versao *getVersao() const { return versao; }
+        const IndiceCSR *getSaida() const { return versao->saida; }
+        const IndiceCSR *getEntrada() const { return versao->entrada; }
+    };
+
+    /**
+     * @brief Construtor. Assume a posse do grafo e publica a versão inicial.
+     *
+     * Se o grafo inicial não couber em um IndiceCSR, os leitores enxergam a
+     * versão 0, sem vértices, até a primeira publicação bem-sucedida.
+     *
+     * @param grafo Grafo a ser versionado.
+     * @param comEntrada Se true, cada versão também guarda o índice de
+     * vizinhos de entrada.
+     */
+    GrafoVersionado(Grafo *grafo, bool comEntrada = false)
+        : grafo(grafo), comEntrada(comEntrada) {
+        Versao *inicial = gerarVersao(1);
+        if (inicial == nullptr) {
+            inicial = new Versao();
+            inicial->saida = new IndiceCSR(0, 0);
+            if (comEntrada)
+                inicial->entrada = new IndiceCSR(0, 0);
+        }
+        atual.store(inicial);
+    }
+
+    GrafoVersionado(const GrafoVersionado &) = delete;
+    GrafoVersionado &operator=(const GrafoVersionado &) = delete;
+
+    /**
+     * @brief Destrutor. Nenhuma leitura pode estar ativa.
+     */
+    ~GrafoVersionado() {
+        for (std::size_t i = 0; i < retiradas.size(); i++)
+            delete retiradas[i].versao;
+        delete atual.load();
+        delete grafo;
+    }
+
+    /**
+     * @brief Reserva uma posição de leitor para a thread chamadora.
+     *
+     * @return Índice da posição, ou -1 se todas estiverem ocupadas.
+     */
+    int registrarLeitor() {
+        for (int i = 0; i < MAX_LEITORES; i++) {
+            bool livre = false;
+            if (leitores[i].ocupada.compare_exchange_strong(livre, true))
+                return i;
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Devolve uma posição de leitor obtida com registrarLeitor.
+     */
+    void liberarLeitor(int posicao) {
+        leitores[posicao].epoca.store(0);
+        leitores[posicao].ocupada.store(false);
+    }
+
+    /**
+     * @brief Adiciona um vértice. Só fica visível após publicar.
+     */
+    bool adicionarVertice(unsigned int v) {
+        std::lock_guard<std::mutex> trava(escrita);
+        return grafo->adicionarVertice(v);
+    }
+
+    /**
+     * @brief Adiciona um lote de arestas. Só fica visível após publicar.
+     */
+    bool adicionarArestas(const tAresta *lote, int n) {
+        std::lock_guard<std::mutex> trava(escrita);
+        return grafo->adicionarArestas(lote, n);
+    }
+
+    /**
+     * @brief Remove um lote de arestas. Só fica visível após publicar.
+     */
+    int removerArestas(const tAresta *lote, int n) {
+        std::lock_guard<std::mutex> trava(escrita);
+        return grafo->removerArestas(lote, n);
+    }
+
+    /**
+     * @brief Publica o estado atual do grafo como uma nova versão.
+     *
+     * A versão anterior é retirada na época corrente, que em seguida avança;
+     * leitores que entrarem depois disso já enxergam a nova versão.
+     *
+     * @return Número da versão publicada, ou 0 se as arestas não couberem em
+     * um IndiceCSR (a versão atual é mantida).
+     */
+    std::uint64_t publicar() {
+        std::lock_guard<std::mutex> trava(escrita);
+        Versao *anterior = atual.load();
+        Versao *nova = gerarVersao(anterior->numero + 1);
+        if (nova == nullptr)
+            return 0;
+
+        atual.store(nova);
+        retiradas.push_back({anterior, epocaGlobal.fetch_add(1)});
+        recolher();
+
+        return nova->numero;
+    }
+
+    /**
+     * @brief Quantidade de versões antigas ainda não liberadas.
+     */
+    std::size_t getVersoesRetidas() {
+        std::lock_guard<std::mutex> trava(escrita);
+        return retiradas.size();
+    }
+};
@@ -6,20 +6,83 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 
+#include "IndiceCSR.hpp"
+
+/**
+ * @struct tAresta
+ * @brief Aresta completa (origem, destino e peso), usada nas operações em lote.
+ */
+typedef struct {
+    int origem;
+    int destino;
+    int peso;
+} tAresta;
+
 class Implementacao {
   protected:
     /**
      * @brief Número de vértices no grafo.
      */
-    int tamanho;
+    int tamanho = 0;
+
+    /**
+     * @brief Índices CSR de saída e de entrada, construídos sob demanda.
+     */
+    IndiceCSR *indiceSaida = nullptr;
+    IndiceCSR *indiceEntrada = nullptr;
+
+    /**
+     * @brief Índices com deslocamentos de 64 bits, construídos sob demanda
+     * quando as arestas não cabem nos de 32 bits.
+     */
+    IndiceCSR64 *indiceSaida64 = nullptr;
+    IndiceCSR64 *indiceEntrada64 = nullptr;
+
+    /**
+     * @brief Quantidade de modificações do grafo (ver getVersao).
+     */
+    unsigned long long versao = 0;
+
+    /**
+     * @brief Descarta os índices construídos. Deve ser chamado sempre que o
+     * grafo for modificado.
+     */
+    void invalidarIndices() {
+        delete indiceSaida;
+        delete indiceEntrada;
+        delete indiceSaida64;
+        delete indiceEntrada64;
+        indiceSaida = nullptr;
+        indiceEntrada = nullptr;
+        indiceSaida64 = nullptr;
+        indiceEntrada64 = nullptr;
+        versao++;
+    }
+
+    /**
+     * @brief Copia os pesos do índice g para a matriz destino (ver
+     * exportarPesos).
+     */
+    template <typename D>
+    void copiarPesos(const IndiceCSRT<D> &g, int *destino, int largura,
+                     int semAresta) {
+        for (int u = 0; u < tamanho; u++) {
+            int *linha = destino + (std::size_t)u * largura;
+            std::fill(linha, linha + tamanho, semAresta);
+            for (const tupla *t = g.inicioVizinhos(u); t != g.fimVizinhos(u);
+                 t++)
+                linha[t->vertice] = t->peso;
+        }
+    }
 
   public:
     /**
      * @brief Destrutor virtual.
      */
-    virtual ~Implementacao() {}
+    virtual ~Implementacao() { invalidarIndices(); }
 
     /**
      * @brief Exibe a representação do grafo.
@@ -31,7 +94,7 @@ class Implementacao {
      * a os vértices.
      * @param labels Vetor de rótulos para os vértices.
      */
-    virtual void mostrar(unsigned int *labels) = 0;
+    virtual void mostrar(const unsigned int *labels) = 0;
 
     /**
      * @brief Adiciona um novo vértice ao grafo.
@@ -49,6 +112,69 @@ class Implementacao {
      */
     virtual bool adicionarAresta(int u, int v, int p) = 0;
 
+    /**
+     * @brief Remove a aresta do vértice u para o vértice v.
+     * @param u Índice do vértice de origem.
+     * @param v Índice do vértice de destino.
+     * @return true se a aresta existia e foi removida, false caso contrário.
+     */
+    virtual bool removerAresta(int u, int v) = 0;
+
+    /**
+     * @brief Verifica se existe a aresta do vértice u para o vértice v.
+     * @param u Índice do vértice de origem.
+     * @param v Índice do vértice de destino.
+     */
+    virtual bool existeAresta(int u, int v) = 0;
+
+    /**
+     * @brief Obtém o peso da aresta do vértice u para o vértice v.
+     * @param u Índice do vértice de origem.
+     * @param v Índice do vértice de destino.
+     * @return Peso da aresta, ou -1 se ela não existir.
+     */
+    virtual int pesoAresta(int u, int v) = 0;
+
+    /**
+     * @brief Adiciona um lote de arestas.
+     *
+     * A implementação padrão insere uma aresta por vez; representações
+     * dinâmicas sobrescrevem este método para processar o lote de uma vez.
+     *
+     * @param lote Vetor de arestas a serem adicionadas.
+     * @param n Quantidade de arestas no lote.
+     * @return true se todas as arestas foram adicionadas.
+     */
+    virtual bool adicionarArestas(const tAresta *lote, int n) {
+        bool resp = true;
+        for (int i = 0; i < n; i++)
+            resp = adicionarAresta(lote[i].origem, lote[i].destino,
+                                   lote[i].peso) &&
+                   resp;
+        return resp;
+    }
+
+    /**
+     * @brief Remove um lote de arestas. O peso das arestas do lote é ignorado.
+     * @param lote Vetor de arestas a serem removidas.
+     * @param n Quantidade de arestas no lote.
+     * @return Quantidade de arestas efetivamente removidas.
+     */
+    virtual int removerArestas(const tAresta *lote, int n) {
+        int removidas = 0;
+        for (int i = 0; i < n; i++)
+            if (removerAresta(lote[i].origem, lote[i].destino))
+                removidas++;
+        return removidas;
+    }
+
+    /**
+     * @brief Obtém a versão do grafo, que muda a cada modificação. Índices
+     * mantidos fora da implementação guardam a versão em que foram
+     * construídos e são refeitos quando ela muda.
+     */
+    unsigned long long getVersao() { return versao; }
+
     /**
      * @brief Obtém o número de vértices no grafo.
      * @return Número de vértices.
@@ -58,4 +184,98 @@ class Implementacao {
     virtual bool caminhamentoEmProfundidade(int v) = 0;
 
     virtual std::size_t getMemoriaOcupada() = 0;
+
+    /**
+     * @brief Indica se a representação guarda todas as V x V posições, caso
+     * em que algoritmos baseados em linhas de bits compensam.
+     */
+    virtual bool isDensa() { return false; }
+
+    /**
+     * @brief Copia as adjacências para um novo índice CSR.
+     * @param transposto Se true, exporta os vizinhos de entrada de cada
+     * vértice em vez dos vizinhos de saída.
+     * @return Novo índice, de responsabilidade do chamador.
+     */
+    virtual IndiceCSR *exportarCSR(bool transposto) = 0;
+
+    /**
+     * @brief Copia as adjacências para um novo índice CSR com deslocamentos
+     * de 64 bits, usado quando exportarCSR retorna nullptr.
+     *
+     * A implementação padrão retorna nullptr: só a ListaAdjacencia64 guarda
+     * mais arestas do que cabem em um int.
+     *
+     * @param transposto Se true, exporta os vizinhos de entrada.
+     * @return Novo índice, de responsabilidade do chamador, ou nullptr.
+     */
+    virtual IndiceCSR64 *exportarCSR64(bool) { return nullptr; }
+
+    /**
+     * @brief Copia os pesos para uma matriz contígua, linha = origem.
+     *
+     * A implementação padrão percorre o índice de saída; a matriz de
+     * adjacência sobrescreve este método para copiar direto das suas linhas.
+     *
+     * @param destino Matriz com ao menos getTamanho() x largura posições;
+     * destino[u * largura + v] recebe o peso da aresta u -> v.
+     * @param largura Distância, em inteiros, entre linhas de destino.
+     * @param semAresta Valor escrito onde não há aresta.
+     * @return false se não houver índice de saída, nem de 32 nem de 64 bits.
+     */
+    virtual bool exportarPesos(int *destino, int largura, int semAresta) {
+        if (const IndiceCSR *g = obterIndiceSaida())
+            copiarPesos(*g, destino, largura, semAresta);
+        else if (const IndiceCSR64 *g = obterIndiceSaida64())
+            copiarPesos(*g, destino, largura, semAresta);
+        else
+            return false;
+        return true;
+    }
+
+    /**
+     * @brief Obtém o índice de vizinhos de saída, construindo-o na primeira
+     * chamada após uma modificação.
+     *
+     * @return Índice, ou nullptr se exportarCSR não puder representar as
+     * arestas com deslocamentos int.
+     */
+    const IndiceCSR *obterIndiceSaida() {
+        if (indiceSaida == nullptr)
+            indiceSaida = exportarCSR(false);
+        return indiceSaida;
+    }
+
+    /**
+     * @brief Obtém o índice de vizinhos de entrada (CSC), construindo-o na
+     * primeira chamada após uma modificação.
+     */
+    const IndiceCSR *obterIndiceEntrada() {
+        if (indiceEntrada == nullptr)
+            indiceEntrada = exportarCSR(true);
+        return indiceEntrada;
+    }
+
+    /**
+     * @brief Obtém o índice de vizinhos de saída com deslocamentos de 64 bits
+     * (ver exportarCSR64), construindo-o na primeira chamada após uma
+     * modificação.
+     *
+     * @return Índice, ou nullptr se a representação não o fornecer.
+     */
+    const IndiceCSR64 *obterIndiceSaida64() {
+        if (indiceSaida64 == nullptr)
+            indiceSaida64 = exportarCSR64(false);
+        return indiceSaida64;
+    }
+
+    /**
+     * @brief Obtém o índice de vizinhos de entrada com deslocamentos de 64
+     * bits, construindo-o na primeira chamada após uma modificação.
+     */
+    const IndiceCSR64 *obterIndiceEntrada64() {
+        if (indiceEntrada64 == nullptr)
+            indiceEntrada64 = exportarCSR64(true);
+        return indiceEntrada64;
+    }
 };
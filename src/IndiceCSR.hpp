@@ -0,0 +1,186 @@
+/**
+ * @file IndiceCSR.hpp
+ * @brief Índice compacto (CSR) e imutável das adjacências de um grafo.
+ *
+ * Estrutura:
+ * - `inicio` possui `tamanho + 1` posições; os vizinhos do vértice v ocupam o
+ *   intervalo [inicio[v], inicio[v + 1]) do array `arestas`.
+ * - Os vizinhos de cada vértice ficam ordenados pelo índice do vizinho.
+ *
+ * O índice é construído uma única vez a partir de uma Implementacao e serve de
+ * base para os algoritmos que precisam percorrer as arestas muitas vezes sem
+ * pagar o custo de cada representação (ex: vizinhos de entrada).
+ *
+ * A largura dos deslocamentos é um parâmetro (IndiceCSRT<D>): IndiceCSR usa
+ * int, que ocupa metade da banda e basta até 2^31 - 1 arestas; IndiceCSR64
+ * usa int64_t para grafos maiores. Os índices de vértice continuam int.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "Percurso.hpp"
+
+/**
+ * @struct tupla
+ * @brief Estrutura auxiliar para armazenar um vizinho e o peso da aresta.
+ *
+ * Campos:
+ * - vertice: índice do vértice vizinho.
+ * - peso: peso da aresta (ou 1 se não ponderado).
+ */
+typedef struct {
+    int vertice = -1;
+    int peso = -1;
+} tupla;
+
+/**
+ * @struct AdjacenciaCSR
+ * @brief Adaptador dos núcleos de Percurso.hpp para listas em formato CSR
+ * (deslocamentos do tipo D com tamanho + 1 posições).
+ */
+template <typename D = int> struct AdjacenciaCSR {
+    const D *inicio;
+    const tupla *arestas;
+
+    std::pair<const tupla *, const tupla *> vizinhos(int v) const {
+        return {arestas + inicio[v], arestas + inicio[v + 1]};
+    }
+
+    void anteciparIndice(int v) const { __builtin_prefetch(&inicio[v]); }
+};
+
+/**
+ * @struct IndiceCSRT
+ * @brief Adjacências em formato CSR (Compressed Sparse Row), com
+ * deslocamentos do tipo D.
+ *
+ * Campos:
+ * - tamanho: número de vértices.
+ * - tArestas: número de arestas armazenadas.
+ * - inicio: deslocamento do primeiro vizinho de cada vértice.
+ * - arestas: vizinhos (e pesos) de todos os vértices, em sequência.
+ */
+template <typename D> struct IndiceCSRT {
+    int tamanho = 0;
+    D tArestas = 0;
+    D *inicio = nullptr;
+    tupla *arestas = nullptr;
+
+    /**
+     * @brief Aloca um índice vazio com espaço para os vértices e arestas.
+     *
+     * @param tamanho Número de vértices.
+     * @param tArestas Número de arestas.
+     */
+    IndiceCSRT(int tamanho, D tArestas)
+        : tamanho(tamanho), tArestas(tArestas), inicio(new D[tamanho + 1]),
+          arestas(new tupla[tArestas]) {
+        inicio[tamanho] = tArestas;
+    }
+
+    IndiceCSRT(const IndiceCSRT &) = delete;
+    IndiceCSRT &operator=(const IndiceCSRT &) = delete;
+
+    /**
+     * @brief Destrutor. Libera os arrays de deslocamentos e arestas.
+     */
+    ~IndiceCSRT() {
+        delete[] inicio;
+        delete[] arestas;
+    }
+
+    /**
+     * @brief Retorna a quantidade de vizinhos do vértice v.
+     */
+    D grau(int v) const { return inicio[v + 1] - inicio[v]; }
+
+    /**
+     * @brief Ponteiro para o primeiro vizinho do vértice v.
+     */
+    const tupla *inicioVizinhos(int v) const { return arestas + inicio[v]; }
+
+    /**
+     * @brief Ponteiro para a posição seguinte ao último vizinho do vértice v.
+     */
+    const tupla *fimVizinhos(int v) const { return arestas + inicio[v + 1]; }
+
+    /**
+     * @brief Constrói o índice transposto (vizinhos de entrada).
+     *
+     * Utiliza contagem por destino: como as origens são visitadas em ordem
+     * crescente, os vizinhos de entrada também ficam ordenados.
+     *
+     * @return Novo índice, de responsabilidade do chamador.
+     */
+    IndiceCSRT *transposto() const {
+        IndiceCSRT *t = new IndiceCSRT(tamanho, tArestas);
+        std::fill(t->inicio, t->inicio + tamanho + 1, 0);
+
+        // Conta o grau de entrada de cada vértice, deslocado em uma posição
+        for (D i = 0; i < tArestas; i++)
+            t->inicio[arestas[i].vertice + 1]++;
+        for (int v = 0; v < tamanho; v++)
+            t->inicio[v + 1] += t->inicio[v];
+
+        D *posicao = new D[tamanho];
+        std::copy(t->inicio, t->inicio + tamanho, posicao);
+        for (int u = 0; u < tamanho; u++) {
+            for (D j = inicio[u]; j < inicio[u + 1]; j++) {
+                tupla &destino = t->arestas[posicao[arestas[j].vertice]++];
+                destino.vertice = u;
+                destino.peso = arestas[j].peso;
+            }
+        }
+
+        delete[] posicao;
+        return t;
+    }
+
+    /**
+     * @brief Caminhamento em largura a partir do vértice v.
+     *
+     * Não altera o índice, podendo ser executado por várias threads ao mesmo
+     * tempo sobre a mesma versão.
+     */
+    bool caminhamentoEmLargura(int v) const {
+        bool *marca = new bool[tamanho];
+        for (int i = 0; i < tamanho; i++)
+            marca[i] = false;
+
+        larguraComPrefetch(tamanho, v, marca,
+                           AdjacenciaCSR<D>{inicio, arestas});
+
+        delete[] marca;
+        return true;
+    }
+
+    /**
+     * @brief Caminhamento em profundidade a partir do vértice v.
+     */
+    bool caminhamentoEmProfundidade(int v) const {
+        bool *marca = new bool[tamanho];
+        for (int i = 0; i < tamanho; i++)
+            marca[i] = false;
+
+        profundidadeComPrefetch(tamanho, v, marca,
+                                AdjacenciaCSR<D>{inicio, arestas});
+
+        delete[] marca;
+        return true;
+    }
+
+    std::size_t getMemoriaOcupada() const {
+        std::size_t t = sizeof(IndiceCSRT);
+        t += sizeof(D) * (tamanho + 1);
+        t += sizeof(tupla) * tArestas;
+        return t;
+    }
+};
+
+typedef IndiceCSRT<int> IndiceCSR;
+typedef IndiceCSRT<std::int64_t> IndiceCSR64;
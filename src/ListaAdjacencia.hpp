@@ -8,49 +8,46 @@
  *
  * Estrutura:
  * - Cada vértice possui um índice no array `vertices`, que aponta para o início
- * de sua lista de vizinhos no array `arestas`.
- * - O array `arestas` armazena pares (vértice, peso) representando as conexões.
+ * de sua lista de vizinhos no array `arestas`. A lista termina onde começa a
+ * do vértice seguinte; `vertices[tamanho]` guarda o total de arestas.
+ * - O array `arestas` armazena pares (vértice, peso) representando as conexões,
+ * com os vizinhos de cada vértice ordenados pelo índice do vizinho.
  *
  * Funcionalidades principais:
  * - Adição de vértices e arestas (com ou sem peso).
+ * - Inserção de lotes de arestas por intercalação, em O(V + E + b log b).
+ * - Consulta de existência e peso de aresta por busca binária.
+ * - Largura dos deslocamentos como parâmetro: ListaAdjacencia usa int (até
+ * 2^31 - 1 arestas, com menos banda de memória) e ListaAdjacencia64 usa
+ * int64_t, para grafos maiores.
  * - Impressão da lista de adjacência, com ou sem rótulos personalizados.
  * - Gerenciamento dinâmico de memória para expansão dos arrays.
  */
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <iostream>
-#include <queue>
-#include <stack>
 #include <stdlib.h>
 #include <cstddef>
+#include <limits>
+#include <vector>
 
 #include "Implementacao.hpp"
 
 /**
- * @struct tupla
- * @brief Estrutura auxiliar para armazenar um vizinho e o peso da aresta.
- *
- * Campos:
- * - vertice: índice do vértice vizinho.
- * - peso: peso da aresta (ou 1 se não ponderado).
- */
-typedef struct {
-    int vertice = -1;
-    int peso = -1;
-} tupla;
-
-/**
- * @class ListaAdjacencia
- * @brief Classe que representa um grafo usando lista de adjacência compacta.
+ * @class ListaAdjacenciaT
+ * @brief Classe que representa um grafo usando lista de adjacência compacta,
+ * com deslocamentos do tipo D.
  *
  * Herda de Implementacao e implementa métodos para manipulação de grafos.
  *
  * Membros protegidos:
- * - int* vertices: Array que armazena o índice inicial da lista de vizinhos de
- * ada vértice.
- * - int tArestas: Quantidade total de arestas armazenadas.
+ * - D* vertices: Array (tamanho + 1 posições) que armazena o índice inicial
+ * da lista de vizinhos de cada vértice.
+ * - D tArestas: Quantidade total de arestas armazenadas.
  * - tupla* arestas: Array de tuplas representando as arestas (vértice vizinho e
  * eso).
  *
@@ -58,20 +55,33 @@ typedef struct {
  * - ListaAdjacencia(bool direcionado, bool ponderado): Construtor.
  * - ~ListaAdjacencia(): Destrutor, libera memória alocada.
  * - void mostrar() override: Imprime a lista de adjacência.
- * - void mostrar(unsigned int* labels) override: Imprime a lista de adjacência
- * om rótulos personalizados.
+ * - void mostrar(const unsigned int* labels) override: Imprime a lista de
+ * adjacência com rótulos personalizados.
  * - int adicionarVertice() override: Adiciona um novo vértice ao grafo.
  * - bool adicionarAresta(int u, int v, int p = 1) override: Adiciona uma aresta
  * entre os vértices u e v, com peso p.
  * - int getTamanho() override: Retorna o número de vértices no grafo.
  */
-class ListaAdjacencia : public Implementacao {
+template <typename D> class ListaAdjacenciaT : public Implementacao {
   protected:
-    int *vertices = nullptr; ///< Matriz de adjacência para armazenar as
-                             ///< onexões entre vértices.
-    int tArestas;
+    D *vertices = nullptr; ///< Matriz de adjacência para armazenar as
+                           ///< onexões entre vértices.
+    D tArestas = 0;
     tupla *arestas = nullptr;
 
+    /**
+     * @brief Busca binária pelo vizinho v na lista do vértice u.
+     *
+     * @return Posição em que v está, ou em que deveria ser inserido para
+     * manter a lista ordenada.
+     */
+    D buscarPosicao(int u, int v) {
+        tupla *it = std::lower_bound(
+            arestas + vertices[u], arestas + vertices[u + 1], v,
+            [](const tupla &t, int x) { return t.vertice < x; });
+        return D(it - arestas);
+    }
+
   public:
     /**
      * @brief Construtor da classe ListaAdjacencia.
@@ -83,7 +93,7 @@ class ListaAdjacencia : public Implementacao {
      * @param direcionado Indica se o grafo é direcionado.
      * @param ponderado Indica se o grafo é ponderado.
      */
-    ListaAdjacencia() = default;
+    ListaAdjacenciaT() = default;
 
     /**
      * @brief Destrutor da classe ListaAdjacencia.
@@ -91,7 +101,7 @@ class ListaAdjacencia : public Implementacao {
      * Libera a memória alocada dinamicamente para os arrays de vértices e a
      * estas.
      */
-    ~ListaAdjacencia() override {
+    ~ListaAdjacenciaT() override {
         delete[] this->arestas;
         delete[] this->vertices;
     }
@@ -111,20 +121,12 @@ class ListaAdjacencia : public Implementacao {
         // Percorre cada vértice do grafo
         for (int i = 0; i < tamanho; i++) {
 
-            // Posição inicial da lista de vizinhos do vértice i
-            int inicio = vertices[i];
-
-            // Posição final da lista de vizinhos:
-            // - se houver próximo vértice com arestas, fim = índice inicial do
-            // pr ximo
-            // - caso contrário (último vértice ou próximo sem vizinhos), fim =
-            // tot l de arestas
-            int fim = (i < tamanho - 1 && vertices[i + 1] != -1)
-                          ? vertices[i + 1]
-                          : tArestas;
+            // Intervalo da lista de vizinhos do vértice i
+            D inicio = vertices[i];
+            D fim = vertices[i + 1];
 
             // Calcula o grau do vértice (quantos vizinhos ele tem)
-            int grau = (inicio == -1) ? 0 : (fim - inicio);
+            D grau = fim - inicio;
 
             // Imprime índice do vértice e o grau
             std::cout << "\t" << i << " (grau " << grau << "): ";
@@ -134,7 +136,7 @@ class ListaAdjacencia : public Implementacao {
                 std::cout << "(sem vizinhos)";
             } else {
                 // Percorre a lista de vizinhos e imprime cada vizinho
-                for (int j = inicio; j < fim; j++) {
+                for (D j = inicio; j < fim; j++) {
                     std::cout << arestas[j].vertice << "(" << arestas[j].peso
                               << ")" << " ";
                 }
@@ -154,7 +156,7 @@ class ListaAdjacencia : public Implementacao {
      *
      * @param labels Array de rótulos personalizados para os vértices.
      */
-    void mostrar(unsigned int *labels) override {
+    void mostrar(const unsigned int *labels) override {
         // Imprime cabeçalho com quantidade de vértices e arestas armazenadas
         std::cout << "Lista de Adjacência (" << tamanho << " vértices, "
                   << tArestas << " arestas armazenadas):\n"
@@ -163,27 +165,12 @@ class ListaAdjacencia : public Implementacao {
         // Percorre cada vértice do grafo
         for (int i = 0; i < tamanho; i++) {
 
-            // Posição inicial da lista de vizinhos do vértice i
-            int inicio = vertices[i];
-
-            // Posição final da lista de vizinhos:
-            // - se houver próximo vértice com arestas, fim = índice inicial do
-            // pr ximo
-            // - caso contrário (último vértice ou próximo sem vizinhos), fim =
-            // tot l de arestas
-            int fim = tArestas;
-            for (int k = i + 1; k < tamanho; k++) {
-                if (vertices[k] != -1) {
-                    fim = vertices[k];
-                    k = tamanho;
-                }
-            }
-            /* int fim = (i < tamanho - 1 && vertices[i + 1] != -1)
-                          ? vertices[i + 1]
-                          : tArestas;
- */
+            // Intervalo da lista de vizinhos do vértice i
+            D inicio = vertices[i];
+            D fim = vertices[i + 1];
+
             // Calcula o grau do vértice (quantos vizinhos ele tem)
-            int grau = (inicio == -1) ? 0 : (fim - inicio);
+            D grau = fim - inicio;
 
             // Imprime índice do vértice e o grau
             std::cout << "\t" << labels[i] << " (grau " << grau << "): ";
@@ -193,7 +180,7 @@ class ListaAdjacencia : public Implementacao {
                 std::cout << "(sem vizinhos)";
             } else {
                 // Percorre a lista de vizinhos e imprime cada vizinho
-                for (int j = inicio; j < fim; j++) {
+                for (D j = inicio; j < fim; j++) {
                     std::cout << labels[arestas[j].vertice] << "("
                               << arestas[j].peso << ")" << " ";
                 }
@@ -214,11 +201,12 @@ class ListaAdjacencia : public Implementacao {
      * alha de alocação.
      */
     int adicionarVertice() override {
-        if (vertices == nullptr)
-            vertices = new int[1];
-        else {
-            int *temp = new int[tamanho + 1];
-            std::copy(vertices, vertices + tamanho, temp);
+        if (vertices == nullptr) {
+            vertices = new D[2];
+            vertices[0] = 0;
+        } else {
+            D *temp = new D[tamanho + 2];
+            std::copy(vertices, vertices + tamanho + 1, temp);
             delete[] vertices;
             vertices = temp;
         }
@@ -226,8 +214,10 @@ class ListaAdjacencia : public Implementacao {
         if (vertices == nullptr)
             return -1;
 
-        vertices[tamanho] = -1;
+        // O novo vértice começa com a lista vazia, no fim do array de arestas
+        vertices[tamanho + 1] = tArestas;
         tamanho++;
+        invalidarIndices();
 
         return tamanho - 1;
     }
@@ -236,60 +226,98 @@ class ListaAdjacencia : public Implementacao {
      * @brief Adiciona uma aresta entre dois vértices.
      *
      * Insere uma nova aresta do vértice u para o vértice v, com peso p (ou 1 se
-     * n o ponderado). Se o grafo não for direcionado, adiciona também a aresta
-     * i versa. Realoca e ajusta os arrays conforme necessário.
+     * não ponderado), na posição que mantém a lista de u ordenada. Se a aresta
+     * já existir, apenas o peso é atualizado. Realoca e ajusta os arrays
+     * conforme necessário.
      *
      * @param u Índice do vértice de origem.
      * @param v Índice do vértice de destino.
      * @param p Peso da aresta (opcional, padrão 1).
-     * @return true se a aresta foi adicionada com sucesso, false em caso de
-     * falha de alocação.
+     * @return true se a aresta foi adicionada com sucesso, false se os índices
+     * forem inválidos ou a quantidade de arestas não couber em D.
      */
     bool adicionarAresta(int u, int v, int p = 1) override {
-        if (arestas == nullptr) {
-            arestas = new tupla[1];
-            arestas->vertice = v;
-            arestas->peso = p;
-        } else {
-            tupla *temp = new tupla[tArestas + 1];
-            std::copy(arestas, arestas + tArestas, temp);
+        if (u < 0 || u >= tamanho || v < 0 || v >= tamanho)
+            return false;
+
+        D pos = buscarPosicao(u, v);
+        if (pos < vertices[u + 1] && arestas[pos].vertice == v) {
+            arestas[pos].peso = p;
+            invalidarIndices();
+            return true;
+        }
+        if (tArestas == std::numeric_limits<D>::max())
+            return false;
+
+        tupla *temp = new tupla[tArestas + 1];
+        if (arestas != nullptr) {
+            // Copia as arestas abrindo espaço na posição de inserção
+            std::copy(arestas, arestas + pos, temp);
+            std::copy(arestas + pos, arestas + tArestas, temp + pos + 1);
             delete[] arestas;
-            arestas = temp;
         }
+        arestas = temp;
 
-        if (arestas == nullptr)
-            return false;
+        // As listas dos vértices seguintes passam a começar uma posição depois
+        for (int i = u + 1; i <= tamanho; i++)
+            vertices[i]++;
 
-        // Se o vértice u não for o último da lista,
-        // é necessário deslocar os ponteiros e arestas
-        int endPos = tArestas;
-        if (u < tamanho - 1) {
-            for (int i = u + 1; i < tamanho; i++) {
-                if (vertices[i] != -1) {
-                    endPos = vertices[i];
-                    break;
-                }
-            }
+        arestas[pos].vertice = v;
+        arestas[pos].peso = p;
+        tArestas++;
+        invalidarIndices();
 
-            for (int i = tArestas; i > endPos; i--)
-                arestas[i] = arestas[i - 1];
-            for (int i = u + 1; i < tamanho; i++)
-                if (vertices[i] > -1)
-                    vertices[i]++;
+        return true;
+    }
 
-            if (vertices[u] == -1)
-                vertices[u] = endPos;
+    /**
+     * @brief Remove a aresta do vértice u para o vértice v.
+     *
+     * Desloca as arestas seguintes uma posição para trás e atualiza o início
+     * das listas dos vértices posteriores.
+     *
+     * @return true se a aresta existia e foi removida, false caso contrário.
+     */
+    bool removerAresta(int u, int v) override {
+        if (u < 0 || u >= tamanho)
+            return false;
 
-        } else if (vertices[u] == -1)
-            vertices[u] = tArestas;
+        D pos = buscarPosicao(u, v);
+        if (pos == vertices[u + 1] || arestas[pos].vertice != v)
+            return false;
 
-        arestas[endPos].vertice = v;
-        arestas[endPos].peso = p;
-        tArestas++;
+        for (D j = pos; j < tArestas - 1; j++)
+            arestas[j] = arestas[j + 1];
+        for (int i = u + 1; i <= tamanho; i++)
+            vertices[i]--;
 
+        tArestas--;
+        invalidarIndices();
         return true;
     }
 
+    /**
+     * @brief Verifica se existe a aresta do vértice u para o vértice v.
+     *
+     * Busca binária na lista ordenada de u: O(log grau(u)).
+     */
+    bool existeAresta(int u, int v) override { return pesoAresta(u, v) != -1; }
+
+    /**
+     * @brief Retorna o peso da aresta do vértice u para o vértice v.
+     *
+     * @return Peso da aresta, ou -1 se ela não existir.
+     */
+    int pesoAresta(int u, int v) override {
+        if (u < 0 || u >= tamanho)
+            return -1;
+
+        D pos = buscarPosicao(u, v);
+        if (pos < vertices[u + 1] && arestas[pos].vertice == v)
+            return arestas[pos].peso;
+        return -1;
+    }
+
     /**
      * @brief Retorna o número de vértices do grafo.
      *
@@ -303,37 +331,10 @@ class ListaAdjacencia : public Implementacao {
             marca[i] = false;
         }
 
-        std::stack<int> *fila = new std::stack<int>;
-        int i = 0, j = 0;
-        fila->push(v);
-
-        while (!fila->empty()) {
-            // insere na fila
-            // label[8] = 3 significa q o 4º vértice (vertice[3]) chama 3
-            // vertice[3] tem a posição do 4º vértice na lista de adjacência (are
-            // tas[vertice[3]])
-            int y = fila->top();
-            fila->pop();
-            if (!marca[y]) {
-                int x = vertices[y];
-                if (x != -1) {
-                    int endPos = tArestas;
-                    for (int i = y + 1; i < tamanho; i++)
-                        if (vertices[i] != -1) {
-                            endPos = vertices[i];
-                            i = tamanho;
-                        }
-                    while (x < endPos) {
-                        fila->push(arestas[x].vertice);
-                        x++;
-                    }
-                }
-                marca[y] = true;
-            }
-        }
+        profundidadeComPrefetch(tamanho, v, marca,
+                                AdjacenciaCSR<D>{vertices, arestas});
 
         delete[] marca;
-        delete fila;
         return true;
     }
 
@@ -342,45 +343,156 @@ class ListaAdjacencia : public Implementacao {
         for (int i = 0; i < tamanho; i++) {
             marca[i] = false;
         }
-        std::queue<int> *fila = new std::queue<int>;
-        int i = 0, j = 0;
-        fila->push(v);
-
-        while (!fila->empty()) {
-            // insere na fila
-            // label[8] = 3 significa q o 4º vértice (vertice[3]) chama 3
-            // vertice[3] tem a posição do 4º vértice na lista de adjacência (are
-            // tas[vertice[3]])
-            int y = fila->front();
-            fila->pop();
-            if (!marca[y]) {
-                int x = vertices[y];
-                if (x != -1) {
-                    int endPos = tArestas;
-                    for (int i = y + 1; i < tamanho; i++)
-                        if (vertices[i] != -1) {
-                            endPos = vertices[i];
-                            i = tamanho;
-                        }
-                    while (x < endPos) {
-                        fila->push(arestas[x].vertice);
-                        x++;
-                    }
-                }
-                marca[y] = true;
-            }
-        }
+
+        larguraComPrefetch(tamanho, v, marca,
+                           AdjacenciaCSR<D>{vertices, arestas});
 
         delete[] marca;
-        delete fila;
         return true;
     }
 
     std::size_t getMemoriaOcupada() override {
-        std::size_t t = sizeof(int *);
-        t += sizeof(int) * tamanho;
+        std::size_t t = sizeof(D *);
+        t += sizeof(D) * (tamanho + 1);
         t += sizeof(tupla *);
         t += sizeof(tupla) * tArestas;
         return t;
     }
+
+    /**
+     * @brief Adiciona um lote de arestas de uma vez.
+     *
+     * Ordena o lote por (origem, destino) e o intercala com as listas atuais
+     * em uma única passada, em vez de deslocar o array de arestas a cada
+     * inserção. Arestas já existentes (ou repetidas no lote) ficam com o
+     * último peso informado, como em adicionarAresta.
+     *
+     * @return false, sem alterar o grafo, se alguma aresta do lote tiver
+     * índices inválidos ou o lote puder passar do limite de D.
+     */
+    bool adicionarArestas(const tAresta *lote, int n) override {
+        for (int i = 0; i < n; i++)
+            if (lote[i].origem < 0 || lote[i].origem >= tamanho ||
+                lote[i].destino < 0 || lote[i].destino >= tamanho)
+                return false;
+        if (tArestas > std::numeric_limits<D>::max() - D(n))
+            return false;
+        if (n == 0)
+            return true;
+
+        std::vector<tAresta> novas(lote, lote + n);
+
+        // Estável: entre repetições, a última do lote fica por último
+        std::stable_sort(novas.begin(), novas.end(),
+                         [](const tAresta &a, const tAresta &b) {
+                             if (a.origem != b.origem)
+                                 return a.origem < b.origem;
+                             return a.destino < b.destino;
+                         });
+
+        D *novosVertices = new D[tamanho + 1];
+        tupla *novasArestas = new tupla[tArestas + D(novas.size())];
+        D k = 0;
+        std::size_t i = 0;
+        for (int u = 0; u < tamanho; u++) {
+            novosVertices[u] = k;
+            D j = vertices[u];
+            while (j < vertices[u + 1] ||
+                   (i < novas.size() && novas[i].origem == u)) {
+                bool doLote = i < novas.size() && novas[i].origem == u;
+                if (doLote && j < vertices[u + 1] &&
+                    arestas[j].vertice < novas[i].destino)
+                    doLote = false;
+
+                if (!doLote) {
+                    novasArestas[k++] = arestas[j++];
+                    continue;
+                }
+                // Última ocorrência do destino no lote; substitui a antiga
+                while (i + 1 < novas.size() && novas[i + 1].origem == u &&
+                       novas[i + 1].destino == novas[i].destino)
+                    i++;
+                if (j < vertices[u + 1] &&
+                    arestas[j].vertice == novas[i].destino)
+                    j++;
+                novasArestas[k].vertice = novas[i].destino;
+                novasArestas[k].peso = novas[i].peso;
+                k++;
+                i++;
+            }
+        }
+        novosVertices[tamanho] = k;
+
+        delete[] vertices;
+        delete[] arestas;
+        vertices = novosVertices;
+        arestas = novasArestas;
+        tArestas = k;
+        invalidarIndices();
+        return true;
+    }
+
+  private:
+    /**
+     * @brief Copia a lista de adjacência para um índice CSR com
+     * deslocamentos do tipo E.
+     *
+     * A lista já está no formato CSR, com os vizinhos ordenados; basta copiar
+     * os dois arrays. O chamador garante que tArestas cabe em E.
+     */
+    template <typename E> IndiceCSRT<E> *copiarIndice(bool transposto) {
+        IndiceCSRT<E> *indice = new IndiceCSRT<E>(tamanho, E(tArestas));
+        std::copy(arestas, arestas + tArestas, indice->arestas);
+        if (tamanho > 0)
+            std::copy(vertices, vertices + tamanho + 1, indice->inicio);
+
+        if (transposto) {
+            IndiceCSRT<E> *t = indice->transposto();
+            delete indice;
+            return t;
+        }
+        return indice;
+    }
+
+  public:
+    /**
+     * @brief Copia a lista de adjacência para um índice CSR com
+     * deslocamentos do mesmo tipo D.
+     *
+     * @param transposto Se true, exporta os vizinhos de entrada.
+     * @return Novo índice, de responsabilidade do chamador.
+     */
+    IndiceCSRT<D> *exportarIndice(bool transposto) {
+        return copiarIndice<D>(transposto);
+    }
+
+    /**
+     * @brief Copia a lista de adjacência para um índice CSR de 32 bits, o
+     * usado pelos algoritmos do Grafo.
+     *
+     * @param transposto Se true, exporta os vizinhos de entrada.
+     * @return Novo índice, de responsabilidade do chamador, ou nullptr se as
+     * arestas não couberem em deslocamentos int (use exportarIndice).
+     */
+    IndiceCSR *exportarCSR(bool transposto) override {
+        if (tArestas > D(std::numeric_limits<int>::max()))
+            return nullptr;
+        return copiarIndice<int>(transposto);
+    }
+
+    /**
+     * @brief Copia a lista de adjacência para um índice CSR de 64 bits, que
+     * os algoritmos do Grafo usam quando exportarCSR retorna nullptr.
+     */
+    IndiceCSR64 *exportarCSR64(bool transposto) override {
+        return copiarIndice<std::int64_t>(transposto);
+    }
+
+    /**
+     * @brief Retorna a quantidade de arestas armazenadas.
+     */
+    D getTArestas() const { return tArestas; }
 };
+
+typedef ListaAdjacenciaT<int> ListaAdjacencia;
+typedef ListaAdjacenciaT<std::int64_t> ListaAdjacencia64;
@@ -0,0 +1,489 @@
+/**
+ * @file ListaDinamica.hpp
+ * @brief Implementação de um grafo com lista de adjacência em blocos com folga,
+ * otimizada para inserções e remoções frequentes de arestas.
+ *
+ * Estrutura:
+ * - Todas as arestas ficam em um único array (`arestas`). Cada vértice ocupa
+ *   um bloco contíguo desse array, com capacidade potência de dois e folga
+ *   para novas arestas.
+ * - Os vizinhos de cada bloco ficam ordenados pelo índice do vizinho.
+ * - Quando um bloco enche, ele é movido para o fim do array com o dobro da
+ *   capacidade, deixando um buraco. Quando os buracos passam de metade do
+ *   array, todos os blocos são compactados na ordem dos vértices, o que
+ *   mantém os percursos praticamente sequenciais na memória.
+ *
+ * Inserções e remoções em lote são ordenadas e aplicadas com uma única
+ * intercalação por vértice, sem deslocar as arestas dos demais vértices.
+ *
+ * As posições do array são int. Com a folga dos blocos e a do array, ele
+ * chega a 12 posições por aresta, por isso a lista guarda no máximo
+ * MAX_ARESTAS arestas; grafos maiores usam ListaAdjacencia64.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <iostream>
+
+#include "Implementacao.hpp"
+
+class ListaDinamica : public Implementacao {
+  private:
+    int *inicio = nullptr;      ///< Início do bloco de cada vértice.
+    int *grau = nullptr;        ///< Quantidade de vizinhos de cada vértice.
+    int *capacidade = nullptr;  ///< Capacidade do bloco de cada vértice.
+    int tamanhoMax = 0;         ///< Capacidade dos vetores de vértices.
+
+    tupla *arestas = nullptr; ///< Blocos de vizinhos de todos os vértices.
+    int tArestas = 0;         ///< Quantidade de arestas armazenadas.
+    int tUsado = 0;           ///< Posições do array já atribuídas a blocos.
+    int tLivre = 0;           ///< Posições abandonadas por blocos movidos.
+    int tArestasMax = 0;      ///< Capacidade do array de arestas.
+
+    /**
+     * @brief Menor potência de dois maior ou igual a n (mínimo 4).
+     */
+    static int proximaPotencia(int n) {
+        int p = 4;
+        while (p < n)
+            p <<= 1;
+        return p;
+    }
+
+    static bool menorAresta(const tAresta &a, const tAresta &b) {
+        return a.origem < b.origem ||
+               (a.origem == b.origem && a.destino < b.destino);
+    }
+
+    /**
+     * @brief Busca binária pelo vizinho v no bloco do vértice u.
+     *
+     * @return Posição do vizinho no array de arestas, ou -1 se não existir.
+     */
+    int buscar(int u, int v) {
+        tupla *b = arestas + inicio[u], *e = b + grau[u];
+        tupla *it = std::lower_bound(
+            b, e, v, [](const tupla &t, int x) { return t.vertice < x; });
+        return (it != e && it->vertice == v) ? int(it - arestas) : -1;
+    }
+
+    /**
+     * @brief Reescreve todos os blocos na ordem dos vértices, eliminando os
+     * buracos e reservando ao menos `extra` posições livres no fim.
+     */
+    void compactar(int extra) {
+        int total = 0;
+        for (int i = 0; i < tamanho; i++) {
+            capacidade[i] = grau[i] == 0 ? 0 : proximaPotencia(grau[i]);
+            total += capacidade[i];
+        }
+
+        int novoMax = std::max(16, 2 * (total + extra));
+        tupla *temp = new tupla[novoMax];
+        int pos = 0;
+        for (int i = 0; i < tamanho; i++) {
+            std::copy(arestas + inicio[i], arestas + inicio[i] + grau[i],
+                      temp + pos);
+            inicio[i] = pos;
+            pos += capacidade[i];
+        }
+
+        delete[] arestas;
+        arestas = temp;
+        tArestasMax = novoMax;
+        tUsado = pos;
+        tLivre = 0;
+    }
+
+    /**
+     * @brief Garante que o bloco do vértice u comporte `necessario` vizinhos.
+     *
+     * Se o bloco for o último do array ele cresce no lugar; caso contrário é
+     * movido para o fim com capacidade dobrada. Os buracos deixados pelos
+     * blocos movidos são recolhidos antes, quando passam de metade do array.
+     */
+    void reservar(int u, int necessario) {
+        if (capacidade[u] >= necessario)
+            return;
+        if (tLivre > tUsado / 2)
+            compactar(0);
+
+        int nova = proximaPotencia(necessario);
+        bool ultimo = inicio[u] + capacidade[u] == tUsado;
+        int falta = ultimo ? nova - capacidade[u] : nova;
+
+        if (tUsado + falta > tArestasMax) {
+            compactar(nova);
+            if (capacidade[u] >= necessario)
+                return;
+            ultimo = inicio[u] + capacidade[u] == tUsado;
+            falta = ultimo ? nova - capacidade[u] : nova;
+        }
+
+        if (!ultimo) {
+            std::copy(arestas + inicio[u], arestas + inicio[u] + grau[u],
+                      arestas + tUsado);
+            tLivre += capacidade[u];
+            inicio[u] = tUsado;
+        }
+        tUsado += falta;
+        capacidade[u] = nova;
+    }
+
+    /**
+     * @brief Insere no bloco de u os k destinos ordenados do lote, que não
+     * existem no bloco, intercalando de trás para frente.
+     */
+    void intercalar(int u, const tAresta *lote, int k) {
+        reservar(u, grau[u] + k);
+        tupla *b = arestas + inicio[u];
+        int i = grau[u] - 1, j = k - 1, w = grau[u] + k - 1;
+        while (j >= 0) {
+            if (i >= 0 && b[i].vertice > lote[j].destino) {
+                b[w--] = b[i--];
+            } else {
+                b[w].vertice = lote[j].destino;
+                b[w--].peso = lote[j].peso;
+                j--;
+            }
+        }
+        grau[u] += k;
+        tArestas += k;
+    }
+
+  public:
+    /**
+     * @brief Maior quantidade de arestas armazenadas: blocos com capacidade
+     * potência de dois (até 4 posições por aresta) mais o dobro disso na
+     * compactação, abaixo de INT_MAX.
+     */
+    static constexpr int MAX_ARESTAS = INT_MAX / 16;
+
+    /**
+     * @brief Adaptador dos núcleos de Percurso.hpp para os blocos.
+     */
+    struct Adjacencia {
+        const int *inicio, *grau;
+        const tupla *arestas;
+
+        std::pair<const tupla *, const tupla *> vizinhos(int v) const {
+            const tupla *b = arestas + inicio[v];
+            return {b, b + grau[v]};
+        }
+
+        void anteciparIndice(int v) const {
+            __builtin_prefetch(&inicio[v]);
+            __builtin_prefetch(&grau[v]);
+        }
+    };
+
+    /**
+     * @brief Adaptador para percorrer as listas com os núcleos de
+     * Percurso.hpp. Inválido após qualquer modificação.
+     */
+    Adjacencia getAdjacencia() const {
+        return Adjacencia{inicio, grau, arestas};
+    }
+
+    /**
+     * @brief Construtor da classe ListaDinamica.
+     */
+    ListaDinamica() = default;
+
+    /**
+     * @brief Destrutor da classe ListaDinamica.
+     */
+    ~ListaDinamica() override {
+        delete[] inicio;
+        delete[] grau;
+        delete[] capacidade;
+        delete[] arestas;
+    }
+
+    /**
+     * @brief Imprime a lista de adjacência do grafo.
+     */
+    void mostrar() override {
+        std::cout << "Lista Dinâmica (" << tamanho << " vértices, " << tArestas
+                  << " arestas armazenadas):\n"
+                  << std::endl;
+
+        for (int i = 0; i < tamanho; i++) {
+            std::cout << "\t" << i << " (grau " << grau[i] << "): ";
+            if (grau[i] == 0)
+                std::cout << "(sem vizinhos)";
+            for (int j = inicio[i]; j < inicio[i] + grau[i]; j++)
+                std::cout << arestas[j].vertice << "(" << arestas[j].peso
+                          << ")" << " ";
+            std::cout << "\n";
+        }
+    }
+
+    /**
+     * @brief Imprime a lista de adjacência do grafo utilizando rótulos
+     * personalizados.
+     *
+     * @param labels Array de rótulos personalizados para os vértices.
+     */
+    void mostrar(const unsigned int *labels) override {
+        std::cout << "Lista Dinâmica (" << tamanho << " vértices, " << tArestas
+                  << " arestas armazenadas):\n"
+                  << std::endl;
+
+        for (int i = 0; i < tamanho; i++) {
+            std::cout << "\t" << labels[i] << " (grau " << grau[i] << "): ";
+            if (grau[i] == 0)
+                std::cout << "(sem vizinhos)";
+            for (int j = inicio[i]; j < inicio[i] + grau[i]; j++)
+                std::cout << labels[arestas[j].vertice] << "("
+                          << arestas[j].peso << ")" << " ";
+            std::cout << "\n";
+        }
+    }
+
+    /**
+     * @brief Adiciona um novo vértice, com bloco vazio.
+     *
+     * Os vetores de vértices crescem dobrando de capacidade.
+     *
+     * @return Índice do novo vértice.
+     */
+    int adicionarVertice() override {
+        if (tamanho == tamanhoMax) {
+            int novoMax = std::max(16, 2 * tamanhoMax);
+            int *novos[3] = {new int[novoMax], new int[novoMax],
+                             new int[novoMax]};
+            int **antigos[3] = {&inicio, &grau, &capacidade};
+            for (int k = 0; k < 3; k++) {
+                if (*antigos[k] != nullptr)
+                    std::copy(*antigos[k], *antigos[k] + tamanho, novos[k]);
+                delete[] *antigos[k];
+                *antigos[k] = novos[k];
+            }
+            tamanhoMax = novoMax;
+        }
+
+        inicio[tamanho] = tUsado;
+        grau[tamanho] = 0;
+        capacidade[tamanho] = 0;
+        tamanho++;
+        invalidarIndices();
+
+        return tamanho - 1;
+    }
+
+    /**
+     * @brief Adiciona (ou atualiza o peso de) uma aresta de u para v.
+     *
+     * @return true se a aresta foi adicionada, false se os índices forem
+     * inválidos.
+     */
+    bool adicionarAresta(int u, int v, int p) override {
+        tAresta a = {u, v, p};
+        return adicionarArestas(&a, 1);
+    }
+
+    /**
+     * @brief Remove a aresta de u para v.
+     *
+     * @return true se a aresta existia e foi removida.
+     */
+    bool removerAresta(int u, int v) override {
+        tAresta a = {u, v, 0};
+        return removerArestas(&a, 1) == 1;
+    }
+
+    /**
+     * @brief Adiciona um lote de arestas.
+     *
+     * O lote é ordenado por (origem, destino); arestas repetidas prevalecem na
+     * última ocorrência e arestas já existentes apenas têm o peso atualizado.
+     * As demais são intercaladas no bloco de cada origem de uma só vez.
+     *
+     * @return false se alguma aresta tiver índices inválidos ou o lote puder
+     * passar de MAX_ARESTAS (nesse caso nenhuma aresta é adicionada).
+     */
+    bool adicionarArestas(const tAresta *lote, int n) override {
+        for (int i = 0; i < n; i++)
+            if (lote[i].origem < 0 || lote[i].origem >= tamanho ||
+                lote[i].destino < 0 || lote[i].destino >= tamanho)
+                return false;
+        if ((long long)tArestas + n > MAX_ARESTAS)
+            return false;
+
+        tAresta *ordenado = new tAresta[n];
+        std::copy(lote, lote + n, ordenado);
+        std::stable_sort(ordenado, ordenado + n, menorAresta);
+
+        int i = 0;
+        while (i < n) {
+            int u = ordenado[i].origem, k = 0;
+            for (; i < n && ordenado[i].origem == u; i++) {
+                // Repetições no lote: mantém apenas a última
+                if (i + 1 < n && ordenado[i + 1].origem == u &&
+                    ordenado[i + 1].destino == ordenado[i].destino)
+                    continue;
+
+                int pos = buscar(u, ordenado[i].destino);
+                if (pos != -1)
+                    arestas[pos].peso = ordenado[i].peso;
+                else
+                    ordenado[k++] = ordenado[i];
+            }
+            if (k > 0)
+                intercalar(u, ordenado, k);
+        }
+
+        delete[] ordenado;
+        invalidarIndices();
+        return true;
+    }
+
+    /**
+     * @brief Remove um lote de arestas, filtrando o bloco de cada origem em
+     * uma única passada.
+     *
+     * @return Quantidade de arestas removidas.
+     */
+    int removerArestas(const tAresta *lote, int n) override {
+        tAresta *ordenado = new tAresta[n];
+        std::copy(lote, lote + n, ordenado);
+        std::sort(ordenado, ordenado + n, menorAresta);
+
+        int removidas = 0, i = 0;
+        while (i < n) {
+            int u = ordenado[i].origem, fimLote = i;
+            while (fimLote < n && ordenado[fimLote].origem == u)
+                fimLote++;
+
+            if (u >= 0 && u < tamanho) {
+                tupla *b = arestas + inicio[u];
+                int w = 0, j = i;
+                for (int r = 0; r < grau[u]; r++) {
+                    while (j < fimLote && ordenado[j].destino < b[r].vertice)
+                        j++;
+                    if (j < fimLote && ordenado[j].destino == b[r].vertice)
+                        continue;
+                    b[w++] = b[r];
+                }
+                removidas += grau[u] - w;
+                tArestas -= grau[u] - w;
+                grau[u] = w;
+            }
+            i = fimLote;
+        }
+
+        delete[] ordenado;
+        if (removidas > 0)
+            invalidarIndices();
+        return removidas;
+    }
+
+    /**
+     * @brief Verifica se existe a aresta de u para v, por busca binária no
+     * bloco ordenado de u.
+     */
+    bool existeAresta(int u, int v) override { return pesoAresta(u, v) != -1; }
+
+    /**
+     * @brief Retorna o peso da aresta de u para v.
+     *
+     * @return Peso da aresta, ou -1 se ela não existir.
+     */
+    int pesoAresta(int u, int v) override {
+        if (u < 0 || u >= tamanho)
+            return -1;
+        int pos = buscar(u, v);
+        return pos == -1 ? -1 : arestas[pos].peso;
+    }
+
+    /**
+     * @brief Quantidade de arestas armazenadas.
+     */
+    int getTArestas() const { return tArestas; }
+
+    /**
+     * @brief Quantidade de vizinhos de saída do vértice u.
+     */
+    int getGrau(int u) const { return grau[u]; }
+
+    /**
+     * @brief Bloco ordenado de vizinhos do vértice u (getGrau(u) posições),
+     * válido até a próxima modificação.
+     */
+    const tupla *getVizinhos(int u) const { return arestas + inicio[u]; }
+
+    /**
+     * @brief Remove todas as arestas que saem de u, mantendo o bloco
+     * reservado para reaproveitamento.
+     */
+    void removerVizinhos(int u) {
+        tArestas -= grau[u];
+        grau[u] = 0;
+        invalidarIndices();
+    }
+
+    /**
+     * @brief Retorna o número de vértices do grafo.
+     */
+    int getTamanho() override { return tamanho; }
+
+    bool caminhamentoEmLargura(int v) override {
+        bool *marca = new bool[tamanho];
+        for (int i = 0; i < tamanho; i++)
+            marca[i] = false;
+
+        larguraComPrefetch(tamanho, v, marca,
+                           getAdjacencia());
+
+        delete[] marca;
+        return true;
+    }
+
+    bool caminhamentoEmProfundidade(int v) override {
+        bool *marca = new bool[tamanho];
+        for (int i = 0; i < tamanho; i++)
+            marca[i] = false;
+
+        profundidadeComPrefetch(tamanho, v, marca,
+                                getAdjacencia());
+
+        delete[] marca;
+        return true;
+    }
+
+    std::size_t getMemoriaOcupada() override {
+        std::size_t t = 3 * sizeof(int *);
+        t += 3 * sizeof(int) * tamanhoMax;
+        t += sizeof(tupla *);
+        t += sizeof(tupla) * tArestasMax;
+        return t;
+    }
+
+    /**
+     * @brief Copia os blocos para um índice CSR, na ordem dos vértices.
+     *
+     * @param transposto Se true, exporta os vizinhos de entrada.
+     * @return Novo índice, de responsabilidade do chamador.
+     */
+    IndiceCSR *exportarCSR(bool transposto) override {
+        IndiceCSR *indice = new IndiceCSR(tamanho, tArestas);
+        int pos = 0;
+        for (int i = 0; i < tamanho; i++) {
+            indice->inicio[i] = pos;
+            std::copy(arestas + inicio[i], arestas + inicio[i] + grau[i],
+                      indice->arestas + pos);
+            pos += grau[i];
+        }
+
+        if (transposto) {
+            IndiceCSR *t = indice->transposto();
+            delete indice;
+            return t;
+        }
+        return indice;
+    }
+};
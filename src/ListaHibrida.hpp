@@ -0,0 +1,440 @@
+/**
+ * @file ListaHibrida.hpp
+ * @brief Implementação híbrida: vértices de grau alto ("hubs") guardam a
+ * linha de adjacência como vetor de bits, e os demais ficam em uma
+ * ListaDinamica.
+ *
+ * Em grafos com distribuição de graus assimétrica, poucos vértices concentram
+ * boa parte das arestas. Para eles a linha de bits é menor que a lista (V/8
+ * bytes contra 8 bytes por vizinho) e dá inserção, remoção e consulta em
+ * O(1). O vetor de pesos da linha só é alocado quando algum peso difere de 1,
+ * então grafos não ponderados pagam apenas os bits.
+ *
+ * A conversão acontece durante as modificações: um vértice vira hub quando
+ * seu grau atinge limiarHub() e volta para a lista quando cai abaixo de um
+ * quarto disso. A folga entre os dois limiares evita conversões repetidas
+ * quando o grau oscila perto do limite.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "Implementacao.hpp"
+#include "ListaDinamica.hpp"
+
+class ListaHibrida : public Implementacao {
+  private:
+    /**
+     * @struct LinhaHub
+     * @brief Linha de adjacência de um hub.
+     */
+    struct LinhaHub {
+        int vertice;
+        int grau;
+        std::uint64_t *bits;
+        int *pesos; ///< nullptr enquanto todos os pesos forem 1.
+    };
+
+    ListaDinamica cauda;        ///< Vizinhos dos vértices que não são hubs.
+    std::vector<int> hub;       ///< Linha de cada vértice em hubs, ou -1.
+    std::vector<LinhaHub> hubs;
+    int colunasHub = 0;         ///< Capacidade das linhas (múltiplo de 64).
+    int tArestasHub = 0;        ///< Arestas guardadas nas linhas de bits.
+
+    bool testar(const LinhaHub &h, int v) const {
+        return (h.bits[v >> 6] >> (v & 63)) & 1;
+    }
+
+    /**
+     * @brief Liga (ou atualiza o peso de) v na linha h.
+     */
+    void ligar(LinhaHub &h, int v, int p) {
+        if (!testar(h, v)) {
+            h.bits[v >> 6] |= std::uint64_t(1) << (v & 63);
+            h.grau++;
+            tArestasHub++;
+        }
+        if (p != 1 && h.pesos == nullptr) {
+            h.pesos = new int[colunasHub];
+            std::fill(h.pesos, h.pesos + colunasHub, 1);
+        }
+        if (h.pesos != nullptr)
+            h.pesos[v] = p;
+    }
+
+    /**
+     * @return true se v estava ligado na linha h.
+     */
+    bool desligar(LinhaHub &h, int v) {
+        if (!testar(h, v))
+            return false;
+        h.bits[v >> 6] &= ~(std::uint64_t(1) << (v & 63));
+        h.grau--;
+        tArestasHub--;
+        return true;
+    }
+
+    /**
+     * @brief Aumenta a capacidade de todas as linhas para comportar o
+     * tamanho atual.
+     */
+    void crescerLinhas() {
+        int novas = std::max(64, 2 * colunasHub);
+        for (LinhaHub &h : hubs) {
+            std::uint64_t *bits = new std::uint64_t[novas / 64]();
+            std::copy(h.bits, h.bits + colunasHub / 64, bits);
+            delete[] h.bits;
+            h.bits = bits;
+            if (h.pesos != nullptr) {
+                int *pesos = new int[novas];
+                std::copy(h.pesos, h.pesos + colunasHub, pesos);
+                std::fill(pesos + colunasHub, pesos + novas, 1);
+                delete[] h.pesos;
+                h.pesos = pesos;
+            }
+        }
+        colunasHub = novas;
+    }
+
+    /**
+     * @brief Move os vizinhos de u da lista para uma nova linha de bits.
+     */
+    void promover(int u) {
+        LinhaHub h = {u, 0, new std::uint64_t[colunasHub / 64](), nullptr};
+        const tupla *viz = cauda.getVizinhos(u);
+        for (int i = 0; i < cauda.getGrau(u); i++)
+            ligar(h, viz[i].vertice, viz[i].peso);
+        cauda.removerVizinhos(u);
+
+        hub[u] = int(hubs.size());
+        hubs.push_back(h);
+    }
+
+    /**
+     * @brief Devolve os vizinhos do hub u para a lista e descarta a linha.
+     */
+    void rebaixar(int u) {
+        LinhaHub &h = hubs[hub[u]];
+        std::vector<tAresta> lote;
+        lote.reserve(h.grau);
+        paraCadaVizinho(u, [&](int v, int p) { lote.push_back({u, v, p}); });
+        tArestasHub -= h.grau;
+        delete[] h.bits;
+        delete[] h.pesos;
+
+        // A última linha ocupa o lugar da removida
+        h = hubs.back();
+        hub[h.vertice] = hub[u];
+        hubs.pop_back();
+        hub[u] = -1;
+
+        cauda.adicionarArestas(lote.data(), int(lote.size()));
+    }
+
+    /**
+     * @brief Adaptador dos núcleos de Percurso.hpp: as listas vêm da cauda e
+     * as linhas dos hubs, de linhaBits.
+     */
+    struct Adjacencia {
+        ListaDinamica::Adjacencia lista;
+        const int *hub;
+        const LinhaHub *hubs;
+        int palavras;
+
+        std::pair<const tupla *, const tupla *> vizinhos(int v) const {
+            return lista.vizinhos(v);
+        }
+
+        void anteciparIndice(int v) const {
+            lista.anteciparIndice(v);
+            __builtin_prefetch(&hub[v]);
+        }
+
+        const std::uint64_t *linhaBits(int v) const {
+            return hub[v] == -1 ? nullptr : hubs[hub[v]].bits;
+        }
+
+        int palavrasLinha() const { return palavras; }
+    };
+
+    Adjacencia getAdjacencia() const {
+        return Adjacencia{cauda.getAdjacencia(), hub.data(), hubs.data(),
+                          (tamanho + 63) / 64};
+    }
+
+    /**
+     * @brief Chama f(vizinho, peso) para cada vizinho de saída de u, em
+     * ordem crescente de vizinho.
+     */
+    template <typename F> void paraCadaVizinho(int u, F f) const {
+        if (hub[u] == -1) {
+            const tupla *viz = cauda.getVizinhos(u);
+            for (int i = 0; i < cauda.getGrau(u); i++)
+                f(viz[i].vertice, viz[i].peso);
+            return;
+        }
+
+        const LinhaHub &h = hubs[hub[u]];
+        for (int w = 0; w < (tamanho + 63) / 64; w++) {
+            for (std::uint64_t b = h.bits[w]; b != 0; b &= b - 1) {
+                int v = w * 64 + __builtin_ctzll(b);
+                f(v, h.pesos == nullptr ? 1 : h.pesos[v]);
+            }
+        }
+    }
+
+    void mostrarLinhas(const unsigned int *labels) {
+        std::cout << "Lista Híbrida (" << tamanho << " vértices, "
+                  << hubs.size() << " hubs, " << getTArestas()
+                  << " arestas armazenadas):\n"
+                  << std::endl;
+
+        for (int i = 0; i < tamanho; i++) {
+            std::cout << "\t" << (labels ? labels[i] : unsigned(i))
+                      << (hub[i] != -1 ? " [hub]" : "") << ": ";
+            bool vazio = true;
+            paraCadaVizinho(i, [&](int v, int p) {
+                std::cout << (labels ? labels[v] : unsigned(v)) << "(" << p
+                          << ")" << " ";
+                vazio = false;
+            });
+            if (vazio)
+                std::cout << "(sem vizinhos)";
+            std::cout << "\n";
+        }
+    }
+
+  public:
+    /**
+     * @brief Grau mínimo para um vértice se tornar hub.
+     */
+    static constexpr int GRAU_MINIMO_HUB = 64;
+
+    /**
+     * @brief Construtor da classe ListaHibrida.
+     */
+    ListaHibrida() = default;
+
+    /**
+     * @brief Destrutor da classe ListaHibrida.
+     */
+    ~ListaHibrida() override {
+        for (LinhaHub &h : hubs) {
+            delete[] h.bits;
+            delete[] h.pesos;
+        }
+    }
+
+    /**
+     * @brief Grau a partir do qual um vértice passa a ser hub: o maior entre
+     * GRAU_MINIMO_HUB e V/32, ponto em que a linha de bits (V/8 bytes) ocupa
+     * metade da lista equivalente.
+     */
+    int limiarHub() const { return std::max(GRAU_MINIMO_HUB, tamanho / 32); }
+
+    /**
+     * @brief Quantidade de vértices guardados como hub.
+     */
+    int getTHubs() const { return int(hubs.size()); }
+
+    /**
+     * @brief Indica se o vértice u está guardado como hub.
+     */
+    bool isHub(int u) const { return hub[u] != -1; }
+
+    /**
+     * @brief Quantidade total de arestas armazenadas.
+     */
+    int getTArestas() const { return tArestasHub + cauda.getTArestas(); }
+
+    void mostrar() override { mostrarLinhas(nullptr); }
+
+    void mostrar(const unsigned int *labels) override { mostrarLinhas(labels); }
+
+    /**
+     * @brief Adiciona um novo vértice, sem vizinhos.
+     *
+     * @return Índice do novo vértice.
+     */
+    int adicionarVertice() override {
+        cauda.adicionarVertice();
+        hub.push_back(-1);
+        tamanho++;
+        if (tamanho > colunasHub)
+            crescerLinhas();
+        invalidarIndices();
+        return tamanho - 1;
+    }
+
+    bool adicionarAresta(int u, int v, int p) override {
+        tAresta a = {u, v, p};
+        return adicionarArestas(&a, 1);
+    }
+
+    bool removerAresta(int u, int v) override {
+        tAresta a = {u, v, 0};
+        return removerArestas(&a, 1) == 1;
+    }
+
+    /**
+     * @brief Adiciona um lote de arestas. Arestas de hubs vão direto para os
+     * bits; as demais seguem em um único lote para a lista, e as origens que
+     * passarem de limiarHub() são promovidas.
+     *
+     * @return false se alguma aresta tiver índices inválidos ou o lote puder
+     * passar de ListaDinamica::MAX_ARESTAS (nesse caso nenhuma aresta é
+     * adicionada).
+     */
+    bool adicionarArestas(const tAresta *lote, int n) override {
+        for (int i = 0; i < n; i++)
+            if (lote[i].origem < 0 || lote[i].origem >= tamanho ||
+                lote[i].destino < 0 || lote[i].destino >= tamanho)
+                return false;
+        // Os hubs podem voltar para a cauda, que tem o limite da lista
+        if ((long long)getTArestas() + n > ListaDinamica::MAX_ARESTAS)
+            return false;
+
+        std::vector<tAresta> loteCauda;
+        for (int i = 0; i < n; i++) {
+            if (hub[lote[i].origem] != -1)
+                ligar(hubs[hub[lote[i].origem]], lote[i].destino,
+                      lote[i].peso);
+            else
+                loteCauda.push_back(lote[i]);
+        }
+
+        if (!loteCauda.empty()) {
+            cauda.adicionarArestas(loteCauda.data(), int(loteCauda.size()));
+            int limiar = limiarHub();
+            for (const tAresta &a : loteCauda)
+                if (hub[a.origem] == -1 && cauda.getGrau(a.origem) >= limiar)
+                    promover(a.origem);
+        }
+
+        invalidarIndices();
+        return true;
+    }
+
+    /**
+     * @brief Remove um lote de arestas. Hubs cujo grau cair abaixo de
+     * limiarHub() / 4 voltam para a lista.
+     *
+     * @return Quantidade de arestas removidas.
+     */
+    int removerArestas(const tAresta *lote, int n) override {
+        std::vector<tAresta> loteCauda;
+        std::vector<int> tocados;
+        int removidas = 0;
+        for (int i = 0; i < n; i++) {
+            int u = lote[i].origem, v = lote[i].destino;
+            if (u < 0 || u >= tamanho || v < 0 || v >= tamanho)
+                continue;
+            if (hub[u] == -1) {
+                loteCauda.push_back(lote[i]);
+            } else if (desligar(hubs[hub[u]], v)) {
+                removidas++;
+                tocados.push_back(u);
+            }
+        }
+
+        if (!loteCauda.empty())
+            removidas +=
+                cauda.removerArestas(loteCauda.data(), int(loteCauda.size()));
+
+        int limiar = limiarHub() / 4;
+        for (int u : tocados)
+            if (hub[u] != -1 && hubs[hub[u]].grau < limiar)
+                rebaixar(u);
+
+        if (removidas > 0)
+            invalidarIndices();
+        return removidas;
+    }
+
+    bool existeAresta(int u, int v) override { return pesoAresta(u, v) != -1; }
+
+    /**
+     * @brief Retorna o peso da aresta de u para v: O(1) para hubs, busca
+     * binária para os demais.
+     *
+     * @return Peso da aresta, ou -1 se ela não existir.
+     */
+    int pesoAresta(int u, int v) override {
+        if (u < 0 || u >= tamanho || v < 0 || v >= tamanho)
+            return -1;
+        if (hub[u] == -1)
+            return cauda.pesoAresta(u, v);
+
+        const LinhaHub &h = hubs[hub[u]];
+        if (!testar(h, v))
+            return -1;
+        return h.pesos == nullptr ? 1 : h.pesos[v];
+    }
+
+    int getTamanho() override { return tamanho; }
+
+    bool caminhamentoEmLargura(int v) override {
+        bool *marca = new bool[tamanho];
+        for (int i = 0; i < tamanho; i++)
+            marca[i] = false;
+
+        larguraComPrefetch(tamanho, v, marca, getAdjacencia());
+
+        delete[] marca;
+        return true;
+    }
+
+    bool caminhamentoEmProfundidade(int v) override {
+        bool *marca = new bool[tamanho];
+        for (int i = 0; i < tamanho; i++)
+            marca[i] = false;
+
+        profundidadeComPrefetch(tamanho, v, marca, getAdjacencia());
+
+        delete[] marca;
+        return true;
+    }
+
+    std::size_t getMemoriaOcupada() override {
+        std::size_t t = cauda.getMemoriaOcupada();
+        t += sizeof(int) * hub.capacity();
+        t += sizeof(LinhaHub) * hubs.capacity();
+        for (const LinhaHub &h : hubs) {
+            t += sizeof(std::uint64_t) * (colunasHub / 64);
+            if (h.pesos != nullptr)
+                t += sizeof(int) * colunasHub;
+        }
+        return t;
+    }
+
+    /**
+     * @brief Monta um índice CSR juntando as linhas de bits e os blocos da
+     * lista, na ordem dos vértices.
+     *
+     * @param transposto Se true, exporta os vizinhos de entrada.
+     * @return Novo índice, de responsabilidade do chamador.
+     */
+    IndiceCSR *exportarCSR(bool transposto) override {
+        IndiceCSR *indice = new IndiceCSR(tamanho, getTArestas());
+        int pos = 0;
+        for (int u = 0; u < tamanho; u++) {
+            indice->inicio[u] = pos;
+            paraCadaVizinho(u, [&](int v, int p) {
+                indice->arestas[pos].vertice = v;
+                indice->arestas[pos++].peso = p;
+            });
+        }
+
+        if (transposto) {
+            IndiceCSR *t = indice->transposto();
+            delete indice;
+            return t;
+        }
+        return indice;
+    }
+};
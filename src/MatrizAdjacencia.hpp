@@ -27,17 +27,23 @@
  * A matriz de adjacência é representada por um ponteiro duplo (int **arestas),
  * o de cada posição indica a existência (e peso, se ponderado) de uma aresta
  * ntre dois vértices.
+ *
+ * Como a aresta u -> v fica em arestas[v][u], os vizinhos de saída de u estão
+ * espalhados por uma coluna. Para os caminhamentos, a classe mantém também
+ * uma matriz de bits com uma linha contígua de vizinhos de saída por vértice
+ * (V / 8 bytes por linha), atualizada a cada modificação.
  */
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <iostream>
-#include <queue>
-#include <stack>
 #include <stdlib.h>
 
 #include "Implementacao.hpp"
+#include "MatrizBits.hpp"
+#include "Percurso.hpp"
 
 class MatrizAdjacencia : public Implementacao {
   private:
@@ -45,6 +51,52 @@ class MatrizAdjacencia : public Implementacao {
                              ///< onexões entre vértices.
     int ultimoVertice;
 
+    /**
+     * @brief Linha u, bit v: existe a aresta u -> v. Tem capacidade para
+     * saida->linhas vértices, dobrada quando o grafo cresce além dela.
+     */
+    MatrizBits *saida = nullptr;
+
+    /**
+     * @brief Garante que a matriz de bits comporte n vértices, copiando as
+     * linhas atuais para uma matriz com o dobro da capacidade se preciso.
+     */
+    void garantirCapacidadeBits(int n) {
+        if (saida != nullptr && saida->linhas >= n)
+            return;
+        int capacidade = std::max(64, saida == nullptr ? n : 2 * saida->linhas);
+        capacidade = std::max(capacidade, n);
+        MatrizBits *nova = new MatrizBits(capacidade, capacidade);
+        if (saida != nullptr) {
+            for (int i = 0; i < saida->linhas; i++)
+                std::copy(saida->linha(i), saida->linha(i) + saida->palavras,
+                          nova->linha(i));
+            delete saida;
+        }
+        saida = nova;
+    }
+
+    /**
+     * @brief Adaptador dos núcleos de Percurso.hpp: não há listas, só as
+     * linhas de bits de vizinhos de saída.
+     */
+    struct Adjacencia {
+        const MatrizBits *saida;
+        int palavras;
+
+        std::pair<const tupla *, const tupla *> vizinhos(int) const {
+            return {nullptr, nullptr};
+        }
+
+        void anteciparIndice(int v) const {
+            __builtin_prefetch(saida->linha(v));
+        }
+
+        const std::uint64_t *linhaBits(int v) const { return saida->linha(v); }
+
+        int palavrasLinha() const { return palavras; }
+    };
+
     /**
      * @brief Realoca o espaço de um vetor de inteiros para um novo tamanho.
      *
@@ -116,6 +168,7 @@ class MatrizAdjacencia : public Implementacao {
             delete[] this->arestas[i];
         }
         delete[] this->arestas;
+        delete saida;
     }
 
     /**
@@ -141,7 +194,7 @@ class MatrizAdjacencia : public Implementacao {
                 std::cout << "\t" << this->arestas[i][j];
             }
 
-            std::cout << std::endl;
+            std::cout << '\n';
         }
     }
 
@@ -154,7 +207,7 @@ class MatrizAdjacencia : public Implementacao {
      * Exibe o tamanho do grafo e a matriz de adjacência, utilizando os rótulos
      * f rnecidos para identificar os vértices.
      */
-    void mostrar(unsigned int *labels) override {
+    void mostrar(const unsigned int *labels) override {
         std::cout << "Tamanho: (" << tamanho << "x" << tamanho << ")"
                   << std::endl;
         std::cout << "\t";
@@ -171,7 +224,7 @@ class MatrizAdjacencia : public Implementacao {
                 std::cout << "\t" << this->arestas[i][j];
             }
 
-            std::cout << std::endl;
+            std::cout << '\n';
         }
     }
 
@@ -199,6 +252,8 @@ class MatrizAdjacencia : public Implementacao {
         }
 
         this->tamanho++; // Atualizar o tamanho da matriz
+        garantirCapacidadeBits(tamanho);
+        invalidarIndices();
 
         return tamanho - 1;
     }
@@ -222,64 +277,93 @@ class MatrizAdjacencia : public Implementacao {
         // retornar false
         if ((u >= 0 && u < this->tamanho) && (v >= 0 && v < this->tamanho)) {
             this->arestas[v][u] = p;
+            if (p == -1)
+                saida->desligar(u, v);
+            else
+                saida->ligar(u, v);
+            invalidarIndices();
             return true;
         }
 
         return false;
     }
 
+    /**
+     * @brief Remove a aresta do vértice u para o vértice v.
+     *
+     * @return true se a aresta existia, false caso contrário ou se os índices
+     * forem inválidos.
+     */
+    bool removerAresta(int u, int v) override {
+        if ((u >= 0 && u < this->tamanho) && (v >= 0 && v < this->tamanho) &&
+            this->arestas[v][u] != -1) {
+            this->arestas[v][u] = -1;
+            saida->desligar(u, v);
+            invalidarIndices();
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Verifica se existe a aresta do vértice u para o vértice v, em
+     * O(1).
+     */
+    bool existeAresta(int u, int v) override { return pesoAresta(u, v) != -1; }
+
+    /**
+     * @brief Retorna o peso da aresta do vértice u para o vértice v, em O(1).
+     *
+     * @return Peso da aresta, ou -1 se ela não existir ou os índices forem
+     * inválidos.
+     */
+    int pesoAresta(int u, int v) override {
+        if ((u >= 0 && u < this->tamanho) && (v >= 0 && v < this->tamanho))
+            return this->arestas[v][u];
+        return -1;
+    }
+
+    /**
+     * @brief Caminhamento em largura a partir do vértice v.
+     *
+     * Usa o núcleo de Percurso.hpp sobre as linhas de bits de saída: cada
+     * vértice expandido custa V / 64 palavras lidas em sequência, em vez de
+     * V posições de uma coluna, e as linhas dos próximos vértices da fila são
+     * pedidas antes de serem lidas.
+     */
     bool caminhamentoEmLargura(int v) override {
-        std::queue<int> *fila = new std::queue<int>();
-        bool *coresVertices = new bool[tamanho];
+        bool *marca = new bool[tamanho];
         for (int i = 0; i < tamanho; i++)
-            coresVertices[i] = false;
-        fila->push(v);
-        while (!fila->empty()) {
-            int verticeAtual = fila->front();
-            fila->pop();
-
-            if (!coresVertices[verticeAtual]) {
-                for (int i = 0; i < tamanho; i++) {
-                    if (arestas[i][verticeAtual] != -1) {
-                        fila->push(i);
-                    }
-                }
-            }
-            coresVertices[verticeAtual] = true;
-        }
+            marca[i] = false;
+
+        larguraComPrefetch(tamanho, v, marca,
+                           Adjacencia{saida, (tamanho + 63) / 64});
 
-        delete fila;
-        delete[] coresVertices;
+        delete[] marca;
         return true;
     }
 
+    /**
+     * @brief Caminhamento em profundidade a partir do vértice v, pelas linhas
+     * de bits de saída (ver caminhamentoEmLargura).
+     */
     bool caminhamentoEmProfundidade(int v) override {
-        std::stack<int> *pilha = new std::stack<int>();
-        bool *coresVertices = new bool[tamanho];
+        bool *marca = new bool[tamanho];
         for (int i = 0; i < tamanho; i++)
-            coresVertices[i] = false;
-        pilha->push(v);
-        while (!pilha->empty()) {
-            int verticeAtual = pilha->top();
-            pilha->pop();
-
-            if (!coresVertices[verticeAtual]) {
-                for (int i = 0; i < tamanho; i++) {
-                    if (arestas[i][verticeAtual] != -1) {
-                        pilha->push(i);
-                    }
-                }
-            }
-            coresVertices[verticeAtual] = true;
-        }
+            marca[i] = false;
+
+        profundidadeComPrefetch(tamanho, v, marca,
+                                Adjacencia{saida, (tamanho + 63) / 64});
 
-        delete[] coresVertices;
-        delete pilha;
+        delete[] marca;
         return true;
     }
 
     int getTamanho() override { return tamanho; }
 
+    bool isDensa() override { return true; }
+
     /**
      * @brief Obtém o número de vértices do grafo.
      *
@@ -289,6 +373,79 @@ class MatrizAdjacencia : public Implementacao {
         std::size_t t = sizeof(int **);
         t += sizeof(int *) * tamanho;
         t += sizeof(int) * tamanho * tamanho;
+        if (saida != nullptr)
+            t += saida->getMemoriaOcupada();
         return t;
     }
+
+    /**
+     * @brief Copia os pesos para uma matriz contígua com linha = origem.
+     *
+     * Como a aresta u -> v fica em arestas[v][u], a cópia é uma transposição,
+     * feita em blocos de 32 x 32 para que leitura e escrita fiquem na cache.
+     */
+    bool exportarPesos(int *destino, int largura, int semAresta) override {
+        const int B = 32;
+        for (int i0 = 0; i0 < tamanho; i0 += B) {
+            for (int j0 = 0; j0 < tamanho; j0 += B) {
+                int iFim = std::min(i0 + B, tamanho);
+                int jFim = std::min(j0 + B, tamanho);
+                for (int i = i0; i < iFim; i++) {
+                    for (int j = j0; j < jFim; j++) {
+                        int p = this->arestas[i][j];
+                        destino[(std::size_t)j * largura + i] =
+                            p == -1 ? semAresta : p;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Copia a matriz de adjacência para um índice CSR.
+     *
+     * A matriz guarda a aresta u -> v em arestas[v][u], ou seja, cada linha
+     * já contém os vizinhos de entrada de um vértice. O índice transposto é
+     * uma leitura direta das linhas; o de saída é montado por contagem,
+     * percorrendo a matriz sempre por linhas.
+     *
+     * @param transposto Se true, exporta os vizinhos de entrada.
+     * @return Novo índice, de responsabilidade do chamador.
+     */
+    IndiceCSR *exportarCSR(bool transposto) override {
+        int *grau = new int[tamanho + 1];
+        for (int i = 0; i <= tamanho; i++)
+            grau[i] = 0;
+
+        int total = 0;
+        for (int i = 0; i < tamanho; i++) {
+            for (int j = 0; j < tamanho; j++) {
+                if (arestas[i][j] != -1) {
+                    grau[transposto ? i : j]++;
+                    total++;
+                }
+            }
+        }
+
+        IndiceCSR *indice = new IndiceCSR(tamanho, total);
+        indice->inicio[0] = 0;
+        for (int i = 0; i < tamanho; i++)
+            indice->inicio[i + 1] = indice->inicio[i] + grau[i];
+        std::copy(indice->inicio, indice->inicio + tamanho, grau);
+
+        for (int i = 0; i < tamanho; i++) {
+            for (int j = 0; j < tamanho; j++) {
+                if (arestas[i][j] != -1) {
+                    tupla &t = transposto ? indice->arestas[grau[i]++]
+                                          : indice->arestas[grau[j]++];
+                    t.vertice = transposto ? j : i;
+                    t.peso = arestas[i][j];
+                }
+            }
+        }
+
+        delete[] grau;
+        return indice;
+    }
 };
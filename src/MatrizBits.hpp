@@ -0,0 +1,77 @@
+/**
+ * @file MatrizBits.hpp
+ * @brief Matriz de bits, uma linha de palavras de 64 bits por vértice.
+ *
+ * Usada quando o grafo é denso: operações sobre conjuntos de vizinhos viram
+ * AND/OR de palavras e contagens viram popcount.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+struct MatrizBits {
+    int linhas = 0;
+    int colunas = 0;
+    int palavras = 0; ///< Palavras de 64 bits por linha.
+    std::uint64_t *bits = nullptr;
+
+    /**
+     * @brief Aloca uma matriz linhas x colunas com todos os bits desligados.
+     */
+    MatrizBits(int linhas, int colunas)
+        : linhas(linhas), colunas(colunas), palavras((colunas + 63) / 64),
+          bits(new std::uint64_t[(std::size_t)linhas * ((colunas + 63) / 64)]) {
+        std::fill(bits, bits + (std::size_t)linhas * palavras, 0);
+    }
+
+    MatrizBits(const MatrizBits &) = delete;
+    MatrizBits &operator=(const MatrizBits &) = delete;
+
+    ~MatrizBits() { delete[] bits; }
+
+    std::uint64_t *linha(int i) { return bits + (std::size_t)i * palavras; }
+    const std::uint64_t *linha(int i) const {
+        return bits + (std::size_t)i * palavras;
+    }
+
+    void ligar(int i, int j) {
+        linha(i)[j >> 6] |= std::uint64_t(1) << (j & 63);
+    }
+
+    void desligar(int i, int j) {
+        linha(i)[j >> 6] &= ~(std::uint64_t(1) << (j & 63));
+    }
+
+    bool testar(int i, int j) const {
+        return (linha(i)[j >> 6] >> (j & 63)) & 1;
+    }
+
+    /**
+     * @brief Quantidade de bits ligados ao mesmo tempo nas linhas i e j.
+     */
+    int contarComuns(int i, int j) const {
+        const std::uint64_t *a = linha(i), *b = linha(j);
+        int c = 0;
+        for (int k = 0; k < palavras; k++)
+            c += __builtin_popcountll(a[k] & b[k]);
+        return c;
+    }
+
+    /**
+     * @brief Faz linha(i) |= linha(j).
+     */
+    void unirLinha(int i, int j) {
+        std::uint64_t *a = linha(i);
+        const std::uint64_t *b = linha(j);
+        for (int k = 0; k < palavras; k++)
+            a[k] |= b[k];
+    }
+
+    std::size_t getMemoriaOcupada() const {
+        return sizeof(MatrizBits) +
+               sizeof(std::uint64_t) * (std::size_t)linhas * palavras;
+    }
+};
@@ -0,0 +1,219 @@
+/**
+ * @file Nucleos.hpp
+ * @brief Decomposição em k-núcleos (k-cores) e ordenação de degenerescência
+ * de grafos não direcionados.
+ *
+ * O k-núcleo é o maior subgrafo em que todo vértice tem grau >= k; o número
+ * de núcleo de v é o maior k cujo k-núcleo contém v. Os dois algoritmos
+ * "descascam" o grafo: removem repetidamente os vértices de menor grau e
+ * descontam as arestas removidas do grau dos vizinhos.
+ *
+ * - Sequencial (Batagelj-Zaversnik): os vértices ficam em um vetor ordenado
+ *   por grau, com o início de cada faixa de grau; decrementar um grau é
+ *   trocar o vértice com o primeiro da sua faixa e avançar o início dela.
+ *   O(V + E).
+ * - Paralelo, por níveis: no nível k, as threads removem ao mesmo tempo
+ *   todos os vértices com grau <= k, decrementando o grau dos vizinhos com
+ *   operações atômicas; quem cai de k + 1 para k entra na próxima rodada do
+ *   mesmo nível. Cada nível não vazio custa uma varredura de V / threads
+ *   vértices por thread, além das arestas removidas.
+ *
+ * A ordem de remoção é uma ordenação de degenerescência: cada vértice tem no
+ * máximo (degenerescência) vizinhos depois dele na ordem.
+ *
+ * Laços (u, u) não contam no grau.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <vector>
+
+#include "IndiceCSR.hpp"
+#include "Paralelo.hpp"
+
+/**
+ * @brief Grau de v sem contar laços.
+ */
+template <typename D> int grauSemLacos(const IndiceCSRT<D> &g, int v) {
+    int grau = int(g.grau(v));
+    for (const tupla *t = g.inicioVizinhos(v); t != g.fimVizinhos(v); t++)
+        if (t->vertice == v)
+            grau--;
+    return grau;
+}
+
+/**
+ * @brief Calcula os números de núcleo pelo algoritmo de Batagelj-Zaversnik.
+ *
+ * @param g Índice de vizinhos (simétrico).
+ * @param nucleo Vetor de saída (g.tamanho posições).
+ * @param ordem Se diferente de nullptr, recebe (g.tamanho posições) os
+ * vértices em uma ordenação de degenerescência.
+ * @return Degenerescência do grafo (maior número de núcleo).
+ */
+template <typename D>
+int nucleosSequencial(const IndiceCSRT<D> &g, int *nucleo,
+                      int *ordem = nullptr) {
+    int n = g.tamanho;
+    std::vector<int> grau(n), vert(n), pos(n);
+    int maiorGrau = 0;
+    for (int v = 0; v < n; v++) {
+        grau[v] = grauSemLacos(g, v);
+        maiorGrau = std::max(maiorGrau, grau[v]);
+    }
+
+    // bin[d]: início da faixa de vértices com grau d em vert
+    std::vector<int> bin(maiorGrau + 1, 0);
+    for (int v = 0; v < n; v++)
+        bin[grau[v]]++;
+    for (int d = 0, inicio = 0; d <= maiorGrau; d++) {
+        int quantidade = bin[d];
+        bin[d] = inicio;
+        inicio += quantidade;
+    }
+    for (int v = 0; v < n; v++) {
+        pos[v] = bin[grau[v]]++;
+        vert[pos[v]] = v;
+    }
+    for (int d = maiorGrau; d > 0; d--)
+        bin[d] = bin[d - 1];
+    bin[0] = 0;
+
+    int degenerescencia = 0;
+    for (int i = 0; i < n; i++) {
+        int v = vert[i];
+        nucleo[v] = grau[v];
+        degenerescencia = std::max(degenerescencia, grau[v]);
+        for (const tupla *t = g.inicioVizinhos(v); t != g.fimVizinhos(v);
+             t++) {
+            int u = t->vertice;
+            if (grau[u] <= grau[v])
+                continue;
+
+            // Move u para o início da sua faixa e encolhe a faixa
+            int du = grau[u], pu = pos[u], pw = bin[du], w = vert[pw];
+            if (u != w) {
+                pos[u] = pw;
+                vert[pu] = w;
+                pos[w] = pu;
+                vert[pw] = u;
+            }
+            bin[du]++;
+            grau[u]--;
+        }
+    }
+
+    if (ordem != nullptr)
+        std::copy(vert.begin(), vert.end(), ordem);
+    return degenerescencia;
+}
+
+/**
+ * @brief Calcula os números de núcleo removendo os vértices de cada nível
+ * em paralelo.
+ *
+ * @param g Índice de vizinhos (simétrico).
+ * @param nucleo Vetor de saída (g.tamanho posições).
+ * @param ordem Se diferente de nullptr, recebe (g.tamanho posições) os
+ * vértices em uma ordenação de degenerescência (por rodada de remoção).
+ * @param threads Quantidade de threads (0 usa numeroThreads()).
+ * @return Degenerescência do grafo (maior número de núcleo).
+ */
+template <typename D>
+int nucleosParalelo(const IndiceCSRT<D> &g, int *nucleo, int *ordem = nullptr,
+                    int threads = 0) {
+    int n = g.tamanho;
+    if (n == 0)
+        return 0;
+    if (threads <= 0)
+        threads = numeroThreads();
+    int partes = std::max(1, std::min(threads, n));
+
+    std::vector<int> limites(partes + 1);
+    particionarPorGrau(g, partes, limites.data());
+
+    std::vector<std::atomic<int>> grau(n);
+    std::vector<std::vector<int>> locais(partes);
+    std::vector<int> minimos(partes), fronteira;
+    int k = 0, processados = 0, degenerescencia = 0;
+    Barreira barreira(partes);
+
+    paraCadaParte(partes, [&](int p) {
+        std::vector<int> &local = locais[p];
+        for (int v = limites[p]; v < limites[p + 1]; v++) {
+            grau[v].store(grauSemLacos(g, v), std::memory_order_relaxed);
+            nucleo[v] = -1;
+        }
+        barreira.esperar();
+
+        while (processados < n) {
+            // Vértices restantes que já têm grau <= k iniciam o nível
+            local.clear();
+            int menor = INT_MAX;
+            for (int v = limites[p]; v < limites[p + 1]; v++) {
+                if (nucleo[v] != -1)
+                    continue;
+                int d = grau[v].load(std::memory_order_relaxed);
+                if (d <= k)
+                    local.push_back(v);
+                else
+                    menor = std::min(menor, d);
+            }
+            minimos[p] = menor;
+            barreira.esperar();
+
+            if (p == 0) {
+                fronteira.clear();
+                for (const std::vector<int> &l : locais)
+                    fronteira.insert(fronteira.end(), l.begin(), l.end());
+                // Nível vazio: pula direto para o menor grau restante
+                if (fronteira.empty())
+                    k = *std::min_element(minimos.begin(), minimos.end());
+            }
+            barreira.esperar();
+
+            while (!fronteira.empty()) {
+                int m = int(fronteira.size());
+                int fim = (long long)m * (p + 1) / partes;
+                local.clear();
+                for (int i = (long long)m * p / partes; i < fim; i++) {
+                    int v = fronteira[i];
+                    nucleo[v] = k;
+                    if (ordem != nullptr)
+                        ordem[processados + i] = v;
+                    for (const tupla *t = g.inicioVizinhos(v);
+                         t != g.fimVizinhos(v); t++) {
+                        int u = t->vertice;
+                        // Vértices já removidos ou nesta rodada têm grau <= k
+                        if (grau[u].load(std::memory_order_relaxed) <= k)
+                            continue;
+                        int antes =
+                            grau[u].fetch_sub(1, std::memory_order_relaxed);
+                        if (antes == k + 1)
+                            local.push_back(u);
+                        else if (antes <= k)
+                            // Outra thread já o levou a k: desfaz
+                            grau[u].fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+                barreira.esperar();
+
+                if (p == 0) {
+                    processados += m;
+                    degenerescencia = k;
+                    fronteira.clear();
+                    for (const std::vector<int> &l : locais)
+                        fronteira.insert(fronteira.end(), l.begin(), l.end());
+                    if (fronteira.empty())
+                        k++;
+                }
+                barreira.esperar();
+            }
+        }
+    });
+
+    return degenerescencia;
+}
@@ -0,0 +1,175 @@
+/**
+ * @file PageRank.hpp
+ * @brief PageRank e multiplicação matriz esparsa-vetor (SpMV) sobre índices
+ * CSR, em paralelo.
+ *
+ * Variantes do PageRank:
+ * - Puxar (pull): cada vértice soma as contribuições dos vizinhos de entrada.
+ *   Cada thread escreve apenas nos seus vértices, sem sincronização.
+ * - Empurrar (push): cada vértice distribui sua contribuição aos vizinhos de
+ *   saída. Cada thread acumula em um vetor próprio, alocado uma vez; a soma
+ *   dos vetores é dividida por vértice entre as threads, que zeram o que
+ *   leram para a próxima iteração.
+ *
+ * As threads são criadas uma vez por chamada e sincronizadas por barreiras
+ * entre as fases de cada iteração.
+ *
+ * Vértices sem arestas de saída distribuem seu rank igualmente entre todos.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "IndiceCSR.hpp"
+#include "Paralelo.hpp"
+
+/**
+ * @brief Calcula y = A * x, em que a linha v de A é a lista de vizinhos de v.
+ *
+ * @param g Índice com as linhas da matriz.
+ * @param x Vetor de entrada (g.tamanho posições).
+ * @param y Vetor de saída (g.tamanho posições).
+ * @param usarPesos Se false, todas as arestas valem 1.
+ * @param threads Quantidade de threads (0 usa numeroThreads()).
+ */
+template <typename D>
+void multiplicarMatrizVetor(const IndiceCSRT<D> &g, const double *x, double *y,
+                            bool usarPesos, int threads = 0) {
+    paraCadaIntervalo(g, threads, [&](int inicio, int fim, int) {
+        for (int v = inicio; v < fim; v++) {
+            double soma = 0;
+            const tupla *t = g.inicioVizinhos(v), *e = g.fimVizinhos(v);
+            if (usarPesos)
+                for (; t != e; t++)
+                    soma += t->peso * x[t->vertice];
+            else
+                for (; t != e; t++)
+                    soma += x[t->vertice];
+            y[v] = soma;
+        }
+    });
+}
+
+/**
+ * @brief Calcula o PageRank de todos os vértices.
+ *
+ * @param saida Índice de vizinhos de saída.
+ * @param entrada Índice de vizinhos de entrada (usado apenas ao puxar).
+ * @param rank Vetor de saída (saida.tamanho posições), com soma 1.
+ * @param puxar Se true usa a variante pull, senão a push.
+ * @param amortecimento Probabilidade de seguir uma aresta (padrão 0.85).
+ * @param tolerancia Para quando a soma das variações (norma L1) for menor.
+ * @param maxIteracoes Limite de iterações.
+ * @param threads Quantidade de threads (0 usa numeroThreads()).
+ * @return Quantidade de iterações executadas.
+ */
+template <typename D>
+int pageRank(const IndiceCSRT<D> &saida, const IndiceCSRT<D> &entrada,
+             double *rank, bool puxar = true, double amortecimento = 0.85,
+             double tolerancia = 1e-6, int maxIteracoes = 100,
+             int threads = 0) {
+    int n = saida.tamanho;
+    if (n == 0)
+        return 0;
+    if (threads <= 0)
+        threads = numeroThreads();
+    threads = std::max(1, std::min(threads, n));
+
+    std::vector<double> contribuicao(n), novo(n);
+    std::vector<int> limites(threads + 1);
+    std::vector<double> erroParte(threads), pendentesParte(threads);
+    std::vector<std::vector<double>> acumulado(puxar ? 0 : threads);
+
+    // Contribuições e atualização do rank são divididas por vértice; a soma
+    // de vizinhos, pelos graus do índice percorrido
+    const IndiceCSRT<D> &percorrido = puxar ? entrada : saida;
+    particionarPorGrau(percorrido, threads, limites.data());
+    for (int v = 0; v < n; v++)
+        rank[v] = 1.0 / n;
+
+    // Uma única equipe de threads para todas as iterações; as fases são
+    // separadas por barreiras em vez de criar threads a cada fase
+    int iteracoes = 0;
+    Barreira barreira(threads);
+    paraCadaParte(threads, [&](int p) {
+        int inicio = (long long)n * p / threads;
+        int fim = (long long)n * (p + 1) / threads;
+        // Alocado uma vez; a soma (abaixo) o deixa zerado para a próxima
+        if (!puxar)
+            acumulado[p].assign(n, 0);
+
+        int iteracao = 0;
+        double erro = tolerancia;
+        while (iteracao < maxIteracoes && erro >= tolerancia) {
+            iteracao++;
+
+            double pendenteLocal = 0;
+            for (int v = inicio; v < fim; v++) {
+                D grau = saida.grau(v);
+                contribuicao[v] = grau > 0 ? rank[v] / grau : 0;
+                pendenteLocal += grau > 0 ? 0 : rank[v];
+            }
+            pendentesParte[p] = pendenteLocal;
+            barreira.esperar();
+
+            double pendente = 0;
+            for (int q = 0; q < threads; q++)
+                pendente += pendentesParte[q];
+            double base =
+                (1 - amortecimento) / n + amortecimento * pendente / n;
+
+            if (puxar) {
+                for (int v = limites[p]; v < limites[p + 1]; v++) {
+                    double soma = 0;
+                    for (const tupla *t = entrada.inicioVizinhos(v);
+                         t != entrada.fimVizinhos(v); t++)
+                        soma += contribuicao[t->vertice];
+                    novo[v] = soma;
+                }
+            } else {
+                double *local = acumulado[p].data();
+                for (int u = limites[p]; u < limites[p + 1]; u++) {
+                    double c = contribuicao[u];
+                    for (const tupla *t = saida.inicioVizinhos(u);
+                         t != saida.fimVizinhos(u); t++)
+                        local[t->vertice] += c;
+                }
+            }
+            barreira.esperar();
+
+            // Soma dos vetores de cada thread (push) e atualização do rank,
+            // sobre o mesmo intervalo de vértices
+            if (!puxar) {
+                for (int v = inicio; v < fim; v++) {
+                    double soma = 0;
+                    for (int q = 0; q < threads; q++) {
+                        soma += acumulado[q][v];
+                        acumulado[q][v] = 0;
+                    }
+                    novo[v] = soma;
+                }
+            }
+            double *__restrict r = rank;
+            const double *__restrict s = novo.data();
+            double e = 0;
+            for (int v = inicio; v < fim; v++) {
+                double valor = base + amortecimento * s[v];
+                e += std::fabs(valor - r[v]);
+                r[v] = valor;
+            }
+            erroParte[p] = e;
+            barreira.esperar();
+
+            erro = 0;
+            for (int q = 0; q < threads; q++)
+                erro += erroParte[q];
+        }
+        if (p == 0)
+            iteracoes = iteracao;
+    });
+
+    return iteracoes;
+}
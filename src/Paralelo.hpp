@@ -0,0 +1,118 @@
+/**
+ * @file Paralelo.hpp
+ * @brief Utilitários para dividir o trabalho sobre um IndiceCSR entre threads.
+ *
+ * Os algoritmos paralelos dividem os vértices em intervalos contíguos com
+ * custo parecido (vértices + arestas), para que uma thread com vértices de
+ * grau alto não atrase as demais.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "IndiceCSR.hpp"
+
+/**
+ * @brief Quantidade de threads usada quando o chamador não define uma.
+ */
+inline int numeroThreads() {
+    int n = int(std::thread::hardware_concurrency());
+    return n > 0 ? n : 1;
+}
+
+/**
+ * @brief Divide os vértices de g em partes intervalos de custo parecido.
+ *
+ * O custo de um vértice é 1 + grau, de forma que o custo acumulado até v é
+ * v + inicio[v] e cada corte é encontrado por busca binária.
+ *
+ * @param g Índice cujos graus definem o custo.
+ * @param partes Quantidade de intervalos.
+ * @param limites Vetor com partes + 1 posições; a parte i recebe os vértices
+ * [limites[i], limites[i + 1]).
+ */
+template <typename D>
+void particionarPorGrau(const IndiceCSRT<D> &g, int partes, int *limites) {
+    long long total = (long long)g.tamanho + g.tArestas;
+    limites[0] = 0;
+    for (int i = 1; i < partes; i++) {
+        long long alvo = total * i / partes;
+        int lo = limites[i - 1], hi = g.tamanho;
+        while (lo < hi) {
+            int meio = lo + (hi - lo) / 2;
+            if ((long long)meio + g.inicio[meio] < alvo)
+                lo = meio + 1;
+            else
+                hi = meio;
+        }
+        limites[i] = lo;
+    }
+    limites[partes] = g.tamanho;
+}
+
+/**
+ * @brief Executa f(parte) para cada parte em [0, partes), uma por thread.
+ *
+ * A thread chamadora executa a parte 0.
+ */
+template <typename F> void paraCadaParte(int partes, F f) {
+    std::vector<std::thread> threads;
+    threads.reserve(partes > 0 ? partes - 1 : 0);
+    for (int i = 1; i < partes; i++)
+        threads.emplace_back(f, i);
+    if (partes > 0)
+        f(0);
+    for (std::thread &t : threads)
+        t.join();
+}
+
+/**
+ * @brief Executa f(inicio, fim, parte) sobre intervalos de vértices de g com
+ * custo balanceado, um por thread.
+ *
+ * @param g Índice cujos graus definem o custo de cada vértice.
+ * @param threads Quantidade de threads (0 usa numeroThreads()).
+ */
+template <typename D, typename F>
+void paraCadaIntervalo(const IndiceCSRT<D> &g, int threads, F f) {
+    if (threads <= 0)
+        threads = numeroThreads();
+    threads = std::max(1, std::min(threads, g.tamanho));
+
+    std::vector<int> limites(threads + 1);
+    particionarPorGrau(g, threads, limites.data());
+    paraCadaParte(threads,
+                  [&](int i) { f(limites[i], limites[i + 1], i); });
+}
+
+/**
+ * @class Barreira
+ * @brief Barreira reutilizável para um número fixo de threads.
+ */
+class Barreira {
+  private:
+    std::mutex trava;
+    std::condition_variable condicao;
+    int total, esperando = 0;
+    unsigned geracao = 0;
+
+  public:
+    explicit Barreira(int total) : total(total) {}
+
+    void esperar() {
+        std::unique_lock<std::mutex> l(trava);
+        unsigned minha = geracao;
+        if (++esperando == total) {
+            esperando = 0;
+            geracao++;
+            condicao.notify_all();
+        } else {
+            condicao.wait(l, [&] { return geracao != minha; });
+        }
+    }
+};
@@ -0,0 +1,617 @@
+/**
+ * @file ParticaoNUMA.hpp
+ * @brief CSR particionado por nó NUMA, com uma equipe fixa de threads
+ * fixadas nas CPUs de cada nó, e busca em largura e PageRank que trocam dados
+ * entre nós por filas.
+ *
+ * Cada nó NUMA recebe um intervalo contíguo de vértices, de custo
+ * proporcional à sua quantidade de CPUs (ver particionarPorGrau), e a sua
+ * fatia do CSR (deslocamentos e arestas desses vértices). A fatia é alocada
+ * e preenchida pelas threads do nó, já fixadas nas suas CPUs. Pela política
+ * de primeiro toque do Linux, as páginas ficam no nó sem depender de
+ * mbind/libnuma.
+ *
+ * As threads de um nó dividem o intervalo do nó entre si e escrevem, com
+ * operações atômicas, nos dados de qualquer vértice do nó. Um vizinho de
+ * outro nó vira uma entrada na fila da thread para aquele nó, consumida
+ * pelas threads do nó de destino depois de uma barreira. Assim as escritas
+ * aleatórias ficam locais ao nó, e o tráfego entre nós fica restrito a
+ * leituras sequenciais das filas (uma por thread e nó de destino).
+ *
+ * As threads são criadas uma única vez, junto com o CSR particionado, e
+ * reaproveitadas por todas as buscas e PageRanks sobre ele.
+ *
+ * A topologia é lida de /sys/devices/system/node. Fora do Linux, ou sem essa
+ * informação, há um único nó com todas as CPUs.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "IndiceCSR.hpp"
+#include "Paralelo.hpp"
+
+/**
+ * @struct TopologiaNUMA
+ * @brief CPUs de cada nó NUMA.
+ */
+struct TopologiaNUMA {
+    std::vector<std::vector<int>> cpus; ///< CPUs de cada nó.
+
+    /**
+     * @brief Converte uma lista de CPUs no formato do kernel ("0-3,8,10-11").
+     */
+    static std::vector<int> lerListaCPUs(const std::string &texto) {
+        std::vector<int> lista;
+        std::stringstream entrada(texto);
+        std::string trecho;
+        while (std::getline(entrada, trecho, ',')) {
+            if (trecho.empty() || !std::isdigit((unsigned char)trecho[0]))
+                continue;
+            std::size_t traco = trecho.find('-');
+            int primeira = std::stoi(trecho.substr(0, traco));
+            int ultima = traco == std::string::npos
+                             ? primeira
+                             : std::stoi(trecho.substr(traco + 1));
+            for (int c = primeira; c <= ultima; c++)
+                lista.push_back(c);
+        }
+        return lista;
+    }
+
+    /**
+     * @brief Lê a topologia da máquina.
+     */
+    static TopologiaNUMA detectar() {
+        TopologiaNUMA t;
+#ifdef __linux__
+        for (int no = 0;; no++) {
+            std::ifstream arquivo("/sys/devices/system/node/node" +
+                                  std::to_string(no) + "/cpulist");
+            if (!arquivo)
+                break;
+            std::string texto;
+            std::getline(arquivo, texto);
+            std::vector<int> lista = lerListaCPUs(texto);
+            // Nós só com memória não recebem vértices
+            if (!lista.empty())
+                t.cpus.push_back(lista);
+        }
+#endif
+        if (t.cpus.empty()) {
+            t.cpus.emplace_back();
+            for (int c = 0; c < numeroThreads(); c++)
+                t.cpus[0].push_back(c);
+        }
+        return t;
+    }
+
+    int getNos() const { return int(cpus.size()); }
+};
+
+/**
+ * @brief Fixa a thread atual na CPU dada. Não faz nada fora do Linux.
+ *
+ * @return false se a afinidade não pôde ser definida.
+ */
+inline bool fixarThread(int cpu) {
+#ifdef __linux__
+    cpu_set_t conjunto;
+    CPU_ZERO(&conjunto);
+    CPU_SET(cpu, &conjunto);
+    return pthread_setaffinity_np(pthread_self(), sizeof(conjunto),
+                                  &conjunto) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+/**
+ * @class EquipeFixada
+ * @brief Threads criadas uma única vez, cada uma fixada em uma CPU, que
+ * executam juntas a tarefa de cada chamada a executar.
+ *
+ * Diferente de PoolThreads, a thread chamadora não trabalha: ela apenas
+ * espera, para não ter sua afinidade alterada.
+ */
+class EquipeFixada {
+  private:
+    std::vector<std::thread> threads;
+    std::mutex mutex, vez;
+    std::condition_variable inicio, fim;
+    std::function<void(int)> tarefa;
+    int pendentes = 0;
+    unsigned geracao = 0;
+    bool parar = false;
+
+    void laco(int trabalhador, int cpu) {
+        fixarThread(cpu);
+        unsigned vista = 0;
+        std::unique_lock<std::mutex> trava(mutex);
+        while (true) {
+            inicio.wait(trava, [&] { return parar || geracao != vista; });
+            if (parar)
+                return;
+            vista = geracao;
+            trava.unlock();
+            tarefa(trabalhador);
+            trava.lock();
+            if (--pendentes == 0)
+                fim.notify_one();
+        }
+    }
+
+  public:
+    /**
+     * @param cpus CPU de cada thread da equipe.
+     */
+    explicit EquipeFixada(const std::vector<int> &cpus) {
+        for (int i = 0; i < int(cpus.size()); i++)
+            threads.emplace_back(&EquipeFixada::laco, this, i, cpus[i]);
+    }
+
+    EquipeFixada(const EquipeFixada &) = delete;
+    EquipeFixada &operator=(const EquipeFixada &) = delete;
+
+    ~EquipeFixada() {
+        {
+            std::lock_guard<std::mutex> trava(mutex);
+            parar = true;
+        }
+        inicio.notify_all();
+        for (std::thread &t : threads)
+            t.join();
+    }
+
+    int getTamanho() const { return int(threads.size()); }
+
+    /**
+     * @brief Executa f(t) em cada thread t da equipe e retorna quando todas
+     * terminarem. Chamadas simultâneas são atendidas uma de cada vez.
+     */
+    void executar(std::function<void(int)> f) {
+        std::lock_guard<std::mutex> minhaVez(vez);
+        {
+            std::lock_guard<std::mutex> trava(mutex);
+            tarefa = std::move(f);
+            pendentes = int(threads.size());
+            geracao++;
+        }
+        inicio.notify_all();
+
+        std::unique_lock<std::mutex> trava(mutex);
+        fim.wait(trava, [&] { return pendentes == 0; });
+    }
+};
+
+/**
+ * @class CSRParticionadoT
+ * @brief Cópia de um IndiceCSRT<D> dividida em uma fatia por nó NUMA, cada
+ * uma alocada no seu nó, com a equipe de threads que a processa.
+ */
+template <typename D> class CSRParticionadoT {
+  public:
+    /**
+     * @struct No
+     * @brief Vértices [primeiro, ultimo) de um nó e suas adjacências. inicio
+     * usa índices locais: os vizinhos de v ficam em
+     * arestas[inicio[v - primeiro], inicio[v - primeiro + 1]). As threads do
+     * nó são [primeiroTrabalhador, primeiroTrabalhador + tTrabalhadores).
+     */
+    struct No {
+        int primeiro = 0, ultimo = 0;
+        D *inicio = nullptr;
+        tupla *arestas = nullptr;
+        D tArestas = 0;
+        int primeiroTrabalhador = 0, tTrabalhadores = 0;
+    };
+
+    /**
+     * @struct Trabalhador
+     * @brief Thread da equipe: o nó e a CPU em que roda, a sua posição entre
+     * as threads do nó e os vértices [primeiro, ultimo) que ela percorre.
+     */
+    struct Trabalhador {
+        int no = 0, cpu = 0, local = 0;
+        int primeiro = 0, ultimo = 0;
+    };
+
+  private:
+    int tamanho = 0;
+    std::vector<No> nos;
+    std::vector<Trabalhador> trabalhadores;
+    std::vector<int> limites; ///< Primeiro vértice de cada nó.
+    std::unique_ptr<EquipeFixada> equipe;
+
+  public:
+    /**
+     * @brief Divide g em uma fatia por nó da topologia, com uma thread por
+     * CPU.
+     *
+     * @param g Índice a particionar (não é modificado).
+     * @param topologia Nós e CPUs; por padrão, os da máquina.
+     * @param tTrabalhadores Quantidade de threads (0 usa uma por CPU),
+     * distribuídas pelos nós na proporção das CPUs. Nós que ficarem sem
+     * threads não recebem vértices.
+     */
+    explicit CSRParticionadoT(
+        const IndiceCSRT<D> &g,
+        const TopologiaNUMA &topologia = TopologiaNUMA::detectar(),
+        int tTrabalhadores = 0)
+        : tamanho(g.tamanho) {
+        int totalCPUs = 0;
+        for (const std::vector<int> &c : topologia.cpus)
+            totalCPUs += int(c.size());
+        if (tTrabalhadores <= 0)
+            tTrabalhadores = totalCPUs;
+        tTrabalhadores =
+            std::max(1, std::min(tTrabalhadores, std::max(1, g.tamanho)));
+
+        // Intervalos de custo parecido, um por thread; as threads
+        // consecutivas de um nó formam o intervalo do nó
+        std::vector<int> intervalos(tTrabalhadores + 1);
+        particionarPorGrau(g, tTrabalhadores, intervalos.data());
+        trabalhadores.resize(tTrabalhadores);
+
+        int t = 0;
+        for (int q = 0; q < topologia.getNos(); q++) {
+            const std::vector<int> &c = topologia.cpus[q];
+            int fim = q + 1 == topologia.getNos()
+                          ? tTrabalhadores
+                          : t + int((long long)tTrabalhadores * c.size() /
+                                    totalCPUs);
+            if (fim == t)
+                continue;
+            No no;
+            no.primeiro = intervalos[t];
+            no.ultimo = intervalos[fim];
+            no.primeiroTrabalhador = t;
+            no.tTrabalhadores = fim - t;
+            for (int local = 0; t < fim; t++, local++) {
+                Trabalhador &eu = trabalhadores[t];
+                eu.no = int(nos.size());
+                eu.cpu = c[local % c.size()];
+                eu.local = local;
+                eu.primeiro = intervalos[t];
+                eu.ultimo = intervalos[t + 1];
+            }
+            limites.push_back(no.primeiro);
+            nos.push_back(no);
+        }
+        limites.push_back(tamanho);
+
+        std::vector<int> cpus;
+        for (const Trabalhador &eu : trabalhadores)
+            cpus.push_back(eu.cpu);
+        equipe.reset(new EquipeFixada(cpus));
+
+        // Primeiro toque: a fatia de cada nó é alocada pela primeira thread
+        // do nó e copiada pelas threads do nó, cada uma o seu intervalo
+        Barreira barreira(tTrabalhadores);
+        executar([&](int t) {
+            const Trabalhador &eu = trabalhadores[t];
+            No &no = nos[eu.no];
+            if (eu.local == 0) {
+                no.tArestas = g.inicio[no.ultimo] - g.inicio[no.primeiro];
+                no.inicio = new D[no.ultimo - no.primeiro + 1];
+                no.arestas = new tupla[no.tArestas];
+            }
+            barreira.esperar();
+
+            D base = g.inicio[no.primeiro];
+            for (int v = eu.primeiro; v < eu.ultimo; v++)
+                no.inicio[v - no.primeiro] = g.inicio[v] - base;
+            if (eu.ultimo == no.ultimo)
+                no.inicio[no.ultimo - no.primeiro] = g.inicio[no.ultimo] - base;
+            std::copy(g.arestas + g.inicio[eu.primeiro],
+                      g.arestas + g.inicio[eu.ultimo],
+                      no.arestas + (g.inicio[eu.primeiro] - base));
+        });
+    }
+
+    CSRParticionadoT(const CSRParticionadoT &) = delete;
+    CSRParticionadoT &operator=(const CSRParticionadoT &) = delete;
+
+    ~CSRParticionadoT() {
+        for (No &no : nos) {
+            delete[] no.inicio;
+            delete[] no.arestas;
+        }
+    }
+
+    /**
+     * @brief Executa f(t) em cada thread t da equipe, fixada na CPU de
+     * getTrabalhador(t), e espera todas terminarem.
+     */
+    void executar(std::function<void(int)> f) const {
+        equipe->executar(std::move(f));
+    }
+
+    int getTamanho() const { return tamanho; }
+    int getTNos() const { return int(nos.size()); }
+    const No &getNo(int q) const { return nos[q]; }
+    int getTTrabalhadores() const { return int(trabalhadores.size()); }
+    const Trabalhador &getTrabalhador(int t) const { return trabalhadores[t]; }
+
+    /**
+     * @brief Nó dono do vértice v (posição em getNo).
+     */
+    int dono(int v) const {
+        return int(std::upper_bound(limites.begin(), limites.end(), v) -
+                   limites.begin()) -
+               1;
+    }
+
+    std::size_t getMemoriaOcupada() const {
+        std::size_t t = sizeof(CSRParticionadoT);
+        t += sizeof(No) * nos.size();
+        t += sizeof(Trabalhador) * trabalhadores.size();
+        t += sizeof(int) * limites.size();
+        for (const No &no : nos) {
+            t += sizeof(D) * (no.ultimo - no.primeiro + 1);
+            t += sizeof(tupla) * no.tArestas;
+        }
+        return t;
+    }
+};
+
+typedef CSRParticionadoT<int> CSRParticionado;
+typedef CSRParticionadoT<int64_t> CSRParticionado64;
+
+/**
+ * @brief Busca em largura por níveis sobre o CSR particionado.
+ *
+ * Cada thread expande a parte da fronteira que ela descobriu: vizinhos do
+ * próprio nó são marcados direto (com compare-and-swap, pois as threads do
+ * nó compartilham o intervalo), os de outros nós vão para a fila (thread,
+ * nó de destino). Depois de uma barreira, as threads de cada nó dividem
+ * entre si as filas destinadas ao nó.
+ *
+ * @param g CSR particionado.
+ * @param origem Vértice de partida.
+ * @param dist Vetor com g.getTamanho() posições; recebe a distância (em
+ * arestas) a partir da origem, ou -1 se inalcançável. Cada thread escreve o
+ * seu intervalo; as páginas só ficam no nó da thread se dist ainda não tiver
+ * sido tocado (por exemplo, recém-alocado com new int[n], sem inicializar).
+ * @return Quantidade de vértices alcançados.
+ */
+template <typename D>
+int buscaEmLarguraParticionada(const CSRParticionadoT<D> &g, int origem,
+                               int *dist) {
+    int n = g.getTamanho();
+    int tTrabalhadores = g.getTTrabalhadores(), tNos = g.getTNos();
+    // filas[t * tNos + q]: vizinhos do nó q encontrados pela thread t
+    std::vector<std::vector<int>> filas((std::size_t)tTrabalhadores * tNos);
+    std::vector<long long> ativos[2] = {
+        std::vector<long long>(tTrabalhadores, 0),
+        std::vector<long long>(tTrabalhadores, 0)};
+    std::vector<int> alcancados(tTrabalhadores, 0);
+    // Sem inicializar: cada thread toca primeiro o seu intervalo
+    std::atomic<int> *distancia = new std::atomic<int>[n];
+    Barreira barreira(tTrabalhadores);
+
+    g.executar([&](int t) {
+        const typename CSRParticionadoT<D>::Trabalhador &eu =
+            g.getTrabalhador(t);
+        const typename CSRParticionadoT<D>::No &no = g.getNo(eu.no);
+        for (int v = eu.primeiro; v < eu.ultimo; v++)
+            distancia[v].store(-1, std::memory_order_relaxed);
+        std::vector<int> fronteira, proxima;
+        if (origem >= eu.primeiro && origem < eu.ultimo) {
+            distancia[origem].store(0, std::memory_order_relaxed);
+            fronteira.push_back(origem);
+            alcancados[t] = 1;
+        }
+        barreira.esperar();
+
+        // Thread única do nó: ninguém mais escreve no intervalo, e o
+        // compare-and-swap é dispensável
+        bool sozinha = no.tTrabalhadores == 1;
+        auto marcar = [&](int w, int d) {
+            int livre = -1;
+            if (distancia[w].load(std::memory_order_relaxed) != -1)
+                return;
+            if (sozinha)
+                distancia[w].store(d, std::memory_order_relaxed);
+            else if (!distancia[w].compare_exchange_strong(
+                         livre, d, std::memory_order_relaxed))
+                return;
+            proxima.push_back(w);
+        };
+
+        for (int nivel = 0;; nivel++) {
+            proxima.clear();
+            for (int u : fronteira) {
+                const D *ini = no.inicio + (u - no.primeiro);
+                for (const tupla *a = no.arestas + ini[0];
+                     a != no.arestas + ini[1]; a++) {
+                    int w = a->vertice;
+                    if (w >= no.primeiro && w < no.ultimo)
+                        marcar(w, nivel + 1);
+                    else
+                        filas[(std::size_t)t * tNos + g.dono(w)].push_back(w);
+                }
+            }
+            barreira.esperar();
+
+            for (int s = eu.local; s < tTrabalhadores;
+                 s += no.tTrabalhadores) {
+                std::vector<int> &fila = filas[(std::size_t)s * tNos + eu.no];
+                for (int w : fila)
+                    marcar(w, nivel + 1);
+                fila.clear();
+            }
+            alcancados[t] += int(proxima.size());
+            ativos[nivel % 2][t] = (long long)proxima.size();
+            fronteira.swap(proxima);
+            barreira.esperar();
+
+            long long total = 0;
+            for (int q = 0; q < tTrabalhadores; q++)
+                total += ativos[nivel % 2][q];
+            if (total == 0)
+                break;
+        }
+
+        for (int v = eu.primeiro; v < eu.ultimo; v++)
+            dist[v] = distancia[v].load(std::memory_order_relaxed);
+    });
+
+    delete[] distancia;
+    int total = 0;
+    for (int a : alcancados)
+        total += a;
+    return total;
+}
+
+/**
+ * @brief Soma valor a destino com um laço de compare-and-swap.
+ */
+inline void somarAtomico(std::atomic<double> &destino, double valor) {
+    double atual = destino.load(std::memory_order_relaxed);
+    while (!destino.compare_exchange_weak(atual, atual + valor,
+                                          std::memory_order_relaxed))
+        ;
+}
+
+/**
+ * @brief PageRank (variante push) sobre o CSR particionado.
+ *
+ * Cada thread distribui as contribuições dos vértices do seu intervalo:
+ * destinos do próprio nó acumulam direto (soma atômica, pois as threads do
+ * nó compartilham o intervalo), os de outros nós vão como pares (vértice,
+ * valor) para a fila (thread, nó de destino), somados pelas threads do nó
+ * de destino depois de uma barreira. Vértices sem arestas de saída
+ * distribuem seu rank igualmente entre todos.
+ *
+ * @param g CSR particionado dos vizinhos de saída.
+ * @param rank Vetor de saída (g.getTamanho() posições), com soma 1.
+ * @return Quantidade de iterações executadas.
+ */
+template <typename D>
+int pageRankParticionado(const CSRParticionadoT<D> &g, double *rank,
+                         double amortecimento = 0.85, double tolerancia = 1e-6,
+                         int maxIteracoes = 100) {
+    int n = g.getTamanho();
+    int tTrabalhadores = g.getTTrabalhadores(), tNos = g.getTNos();
+    if (n == 0)
+        return 0;
+
+    struct Entrada {
+        int vertice;
+        double valor;
+    };
+    // filas[t * tNos + q]: contribuições da thread t para o nó q
+    std::vector<std::vector<Entrada>> filas((std::size_t)tTrabalhadores *
+                                            tNos);
+    std::vector<double> pendentes[2] = {std::vector<double>(tTrabalhadores),
+                                        std::vector<double>(tTrabalhadores)};
+    std::vector<double> erros[2] = {std::vector<double>(tTrabalhadores),
+                                    std::vector<double>(tTrabalhadores)};
+    // Sem inicializar: cada thread toca primeiro o seu intervalo
+    std::atomic<double> *novo = new std::atomic<double>[n];
+    int iteracoes = 0;
+    Barreira barreira(tTrabalhadores);
+
+    g.executar([&](int t) {
+        const typename CSRParticionadoT<D>::Trabalhador &eu =
+            g.getTrabalhador(t);
+        const typename CSRParticionadoT<D>::No &no = g.getNo(eu.no);
+        // Thread única do nó: a soma dispensa o compare-and-swap
+        bool sozinha = no.tTrabalhadores == 1;
+        auto somar = [&](int w, double valor) {
+            if (sozinha)
+                novo[w].store(novo[w].load(std::memory_order_relaxed) + valor,
+                              std::memory_order_relaxed);
+            else
+                somarAtomico(novo[w], valor);
+        };
+        for (int v = eu.primeiro; v < eu.ultimo; v++) {
+            rank[v] = 1.0 / n;
+            novo[v].store(0, std::memory_order_relaxed);
+        }
+        barreira.esperar();
+
+        for (int it = 0; it < maxIteracoes; it++) {
+            double pendente = 0;
+            for (int u = eu.primeiro; u < eu.ultimo; u++) {
+                const D *ini = no.inicio + (u - no.primeiro);
+                D grau = ini[1] - ini[0];
+                if (grau == 0) {
+                    pendente += rank[u];
+                    continue;
+                }
+                double c = rank[u] / grau;
+                for (const tupla *a = no.arestas + ini[0];
+                     a != no.arestas + ini[1]; a++) {
+                    int w = a->vertice;
+                    if (w >= no.primeiro && w < no.ultimo)
+                        somar(w, c);
+                    else
+                        filas[(std::size_t)t * tNos + g.dono(w)].push_back(
+                            {w, c});
+                }
+            }
+            pendentes[it % 2][t] = pendente;
+            barreira.esperar();
+
+            for (int s = eu.local; s < tTrabalhadores;
+                 s += no.tTrabalhadores) {
+                std::vector<Entrada> &fila =
+                    filas[(std::size_t)s * tNos + eu.no];
+                for (const Entrada &e : fila)
+                    somar(e.vertice, e.valor);
+                fila.clear();
+            }
+            barreira.esperar();
+
+            double totalPendente = 0;
+            for (int q = 0; q < tTrabalhadores; q++)
+                totalPendente += pendentes[it % 2][q];
+            double base =
+                (1 - amortecimento) / n + amortecimento * totalPendente / n;
+            double erro = 0;
+            for (int v = eu.primeiro; v < eu.ultimo; v++) {
+                double valor =
+                    base + amortecimento *
+                               novo[v].load(std::memory_order_relaxed);
+                erro += std::fabs(valor - rank[v]);
+                rank[v] = valor;
+                novo[v].store(0, std::memory_order_relaxed);
+            }
+            erros[it % 2][t] = erro;
+            barreira.esperar();
+
+            double total = 0;
+            for (int q = 0; q < tTrabalhadores; q++)
+                total += erros[it % 2][q];
+            if (t == 0)
+                iteracoes = it + 1;
+            if (total < tolerancia)
+                break;
+        }
+    });
+
+    delete[] novo;
+    return iteracoes;
+}
@@ -0,0 +1,195 @@
+/**
+ * @file Percurso.hpp
+ * @brief Núcleos de busca em largura e em profundidade com pré-busca
+ * (prefetch) em software, compartilhados pelas representações em lista e
+ * pela matriz de adjacência.
+ *
+ * Em grafos maiores que a cache, cada vizinho custa duas leituras
+ * dependentes da memória principal: o início da lista do vértice e a marca
+ * de visitado do vizinho. Os núcleos escondem essa latência em duas
+ * distâncias, ao longo da fila (ou pilha) de vértices a expandir:
+ * - a DISTANCIA_INDICE posições à frente, pede o deslocamento da lista do
+ *   vértice;
+ * - a DISTANCIA_LISTA posições à frente, pede a lista (ou linha de bits) em
+ *   si, cujo deslocamento já deve estar na cache;
+ * - dentro da lista, pede a marca do vizinho DISTANCIA_MARCA posições à
+ *   frente.
+ * Assim várias faltas de cache ficam em andamento ao mesmo tempo, em vez de
+ * uma por vez.
+ *
+ * O acesso à representação é feito por um adaptador com dois métodos:
+ * - `vizinhos(int v)`, que retorna o par de ponteiros [início, fim) da lista
+ *   de v (elementos com o campo `vertice`, como tupla);
+ * - `anteciparIndice(int v)`, que pede os metadados da lista de v.
+ * Representações que guardam algumas linhas como vetor de bits (ListaHibrida,
+ * ou todas, MatrizAdjacencia) fornecem também `linhaBits(int v)`, com a
+ * linha de v ou nullptr se v usa a lista, e `palavrasLinha()`, a quantidade
+ * de palavras de 64 bits por linha.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+const int DISTANCIA_INDICE = 16;
+const int DISTANCIA_LISTA = 8;
+const int DISTANCIA_MARCA = 8;
+
+/**
+ * @brief Pede a lista de vizinhos [b, e) para a cache (até 4 linhas de
+ * 64 bytes, o suficiente para os primeiros vizinhos).
+ */
+template <typename T> inline void anteciparLista(const T *b, const T *e) {
+    const char *p = reinterpret_cast<const char *>(b);
+    const char *fim = reinterpret_cast<const char *>(e);
+    for (int i = 0; i < 4 && p < fim; i++, p += 64)
+        __builtin_prefetch(p);
+}
+
+/**
+ * @brief Indica se o adaptador Adj fornece linhas de bits (linhaBits).
+ */
+template <typename Adj, typename = void>
+struct TemLinhasBits : std::false_type {};
+
+template <typename Adj>
+struct TemLinhasBits<
+    Adj, std::void_t<decltype(std::declval<const Adj &>().linhaBits(0))>>
+    : std::true_type {};
+
+/**
+ * @brief Chama f(w) para cada vizinho w de v, se v guarda a linha como
+ * vetor de bits; adaptadores sem linhas de bits não fazem nada.
+ */
+template <typename Adj, typename F>
+inline void paraCadaVizinhoLinha(const Adj &adj, int v, F f) {
+    if constexpr (TemLinhasBits<Adj>::value) {
+        const std::uint64_t *bits = adj.linhaBits(v);
+        if (bits == nullptr)
+            return;
+        for (int p = 0; p < adj.palavrasLinha(); p++)
+            for (std::uint64_t b = bits[p]; b != 0; b &= b - 1)
+                f(p * 64 + __builtin_ctzll(b));
+    }
+}
+
+/**
+ * @brief Pede para a cache o início da lista de vizinhos de v e, se houver,
+ * da sua linha de bits.
+ */
+template <typename Adj> inline void anteciparVizinhos(const Adj &adj, int v) {
+    auto l = adj.vizinhos(v);
+    anteciparLista(l.first, l.second);
+    if constexpr (TemLinhasBits<Adj>::value) {
+        const std::uint64_t *bits = adj.linhaBits(v);
+        if (bits != nullptr)
+            anteciparLista(bits, bits + adj.palavrasLinha());
+    }
+}
+
+/**
+ * @brief Percorre os vizinhos [b, e), marcando e chamando novo(w) para cada
+ * vizinho w ainda não marcado.
+ */
+template <typename T, typename F>
+inline void expandirComPrefetch(const T *b, const T *e, bool *marca, F novo) {
+    for (const T *t = b; t != e; t++) {
+        if (e - t > DISTANCIA_MARCA)
+            __builtin_prefetch(&marca[t[DISTANCIA_MARCA].vertice], 1);
+        int w = t->vertice;
+        if (!marca[w]) {
+            marca[w] = true;
+            novo(w);
+        }
+    }
+}
+
+/**
+ * @brief Busca em largura a partir de v com pré-busca da fila.
+ *
+ * @param n Quantidade de vértices.
+ * @param marca Vetor com n posições, todas false; recebe os alcançados.
+ * @return Quantidade de vértices alcançados.
+ */
+template <typename Adj>
+int larguraComPrefetch(int n, int v, bool *marca, const Adj &adj) {
+    int *fila = new int[n];
+    int cabeca = 0, fim = 0;
+    fila[fim++] = v;
+    marca[v] = true;
+
+    while (cabeca < fim) {
+        if (cabeca + DISTANCIA_INDICE < fim)
+            adj.anteciparIndice(fila[cabeca + DISTANCIA_INDICE]);
+        if (cabeca + DISTANCIA_LISTA < fim)
+            anteciparVizinhos(adj, fila[cabeca + DISTANCIA_LISTA]);
+
+        int y = fila[cabeca++];
+        auto novo = [&](int w) { fila[fim++] = w; };
+        auto l = adj.vizinhos(y);
+        expandirComPrefetch(l.first, l.second, marca, novo);
+        paraCadaVizinhoLinha(adj, y, [&](int w) {
+            if (!marca[w]) {
+                marca[w] = true;
+                novo(w);
+            }
+        });
+    }
+
+    delete[] fila;
+    return fim;
+}
+
+/**
+ * @brief Busca em profundidade a partir de v (pilha explícita, marcando ao
+ * desempilhar), com pré-busca dos próximos vértices da pilha.
+ *
+ * A pilha muda a cada expansão, então as posições antecipadas são uma
+ * estimativa: os próximos vértices desempilhados são os últimos empilhados.
+ * Como cada vértice expandido depende do anterior, o ganho aqui é bem menor
+ * que na busca em largura.
+ *
+ * @param marca Vetor com n posições, todas false; recebe os alcançados.
+ * @return Quantidade de vértices alcançados.
+ */
+template <typename Adj>
+int profundidadeComPrefetch(int n, int v, bool *marca, const Adj &adj) {
+    std::vector<int> pilha;
+    pilha.reserve(n);
+    pilha.push_back(v);
+    int alcancados = 0;
+
+    while (!pilha.empty()) {
+        int topo = int(pilha.size()) - 1;
+        if (topo >= DISTANCIA_INDICE) {
+            int x = pilha[topo - DISTANCIA_INDICE];
+            adj.anteciparIndice(x);
+            __builtin_prefetch(&marca[x]);
+        }
+        if (topo >= DISTANCIA_LISTA)
+            anteciparVizinhos(adj, pilha[topo - DISTANCIA_LISTA]);
+
+        int y = pilha.back();
+        pilha.pop_back();
+        if (marca[y])
+            continue;
+        marca[y] = true;
+        alcancados++;
+
+        auto l = adj.vizinhos(y);
+        for (auto t = l.first; t != l.second; t++) {
+            if (l.second - t > DISTANCIA_MARCA)
+                __builtin_prefetch(&marca[t[DISTANCIA_MARCA].vertice]);
+            if (!marca[t->vertice])
+                pilha.push_back(t->vertice);
+        }
+        paraCadaVizinhoLinha(adj, y, [&](int w) {
+            if (!marca[w])
+                pilha.push_back(w);
+        });
+    }
+    return alcancados;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file Representacao.hpp
+ * @brief Escolha automática da implementação de um grafo a partir do número
+ * esperado de vértices e arestas.
+ *
+ * Regras (densidade = arestas armazenadas / V², contando as duas direções em
+ * grafos não direcionados):
+ * - arestas armazenadas > ListaDinamica::MAX_ARESTAS: ListaAdjacencia64, a
+ *   única com deslocamentos de 64 bits. Deve ser preenchida em lotes
+ *   (adicionarArestas); acima de 2^31 - 1 arestas os algoritmos do Grafo
+ *   passam a usar o índice CSR de 64 bits (ver Grafo::obterIndiceSaida64).
+ * - densidade >= 1/4 e V <= LIMITE_VERTICES_MATRIZ: MatrizAdjacencia. A
+ *   matriz ocupa no máximo o dobro da lista, tem consultas O(1) e habilita os
+ *   caminhos densos (ex.: triângulos por matriz de bits).
+ * - densidade >= 1/64 (1/16 se ponderado): ListaHibrida. Com essa densidade
+ *   é comum haver vértices acima do limiar de hub; em grafos ponderados as
+ *   linhas dos hubs também guardam um vetor de pesos, então o limite é maior.
+ * - caso contrário: ListaDinamica, que aceita inserções em O(grau) enquanto o
+ *   grafo é montado. A ListaAdjacencia (CSR compacto) desloca todas as
+ *   arestas seguintes a cada inserção e só é escolhida explicitamente.
+ */
+
+#pragma once
+
+#include "Grafo.hpp"
+#include "ListaAdjacencia.hpp"
+#include "ListaDinamica.hpp"
+#include "ListaHibrida.hpp"
+#include "MatrizAdjacencia.hpp"
+
+/**
+ * @enum Representacao
+ * @brief Implementações disponíveis para um Grafo.
+ */
+enum class Representacao {
+    AUTOMATICA,
+    MATRIZ,
+    LISTA,
+    LISTA_64,
+    LISTA_DINAMICA,
+    HIBRIDA
+};
+
+/**
+ * @brief Maior quantidade de vértices para a qual a matriz é considerada
+ * (8192² inteiros = 256 MB).
+ */
+const int LIMITE_VERTICES_MATRIZ = 8192;
+
+/**
+ * @brief Escolhe a implementação para um grafo com as características dadas.
+ *
+ * @param vertices Quantidade esperada de vértices.
+ * @param arestas Quantidade esperada de arestas (cada aresta não direcionada
+ * conta uma vez).
+ */
+inline Representacao escolherRepresentacao(int vertices, long long arestas,
+                                           bool direcionado, bool ponderado) {
+    if (vertices <= 0)
+        return Representacao::LISTA_DINAMICA;
+
+    double armazenadas = double(direcionado ? arestas : 2 * arestas);
+    if (armazenadas > ListaDinamica::MAX_ARESTAS)
+        return Representacao::LISTA_64;
+    double densidade = armazenadas / (double(vertices) * vertices);
+
+    if (densidade >= 0.25 && vertices <= LIMITE_VERTICES_MATRIZ)
+        return Representacao::MATRIZ;
+    if (densidade >= (ponderado ? 1.0 / 16 : 1.0 / 64))
+        return Representacao::HIBRIDA;
+    return Representacao::LISTA_DINAMICA;
+}
+
+/**
+ * @brief Cria uma implementação vazia do tipo pedido.
+ *
+ * @return Nova implementação, de responsabilidade do chamador, ou nullptr
+ * para Representacao::AUTOMATICA.
+ */
+inline Implementacao *criarImplementacao(Representacao r) {
+    switch (r) {
+    case Representacao::MATRIZ:
+        return new MatrizAdjacencia();
+    case Representacao::LISTA:
+        return new ListaAdjacencia();
+    case Representacao::LISTA_64:
+        return new ListaAdjacencia64();
+    case Representacao::LISTA_DINAMICA:
+        return new ListaDinamica();
+    case Representacao::HIBRIDA:
+        return new ListaHibrida();
+    default:
+        return nullptr;
+    }
+}
+
+/**
+ * @brief Cria um grafo vazio com a implementação mais adequada.
+ *
+ * @param vertices Quantidade esperada de vértices.
+ * @param arestas Quantidade esperada de arestas.
+ * @param r Implementação a usar; AUTOMATICA aplica escolherRepresentacao.
+ * @return Novo grafo, de responsabilidade do chamador.
+ */
+inline Grafo *criarGrafo(int vertices, long long arestas, bool direcionado,
+                         bool ponderado, bool rotulado,
+                         Representacao r = Representacao::AUTOMATICA) {
+    if (r == Representacao::AUTOMATICA)
+        r = escolherRepresentacao(vertices, arestas, direcionado, ponderado);
+    return new Grafo(criarImplementacao(r), direcionado, ponderado, rotulado);
+}
@@ -0,0 +1,190 @@
+/**
+ * @file Rotulos.hpp
+ * @brief Mapeamento entre rótulos (chaves) dos vértices e índices internos.
+ *
+ * Os índices são atribuídos em ordem de inserção (0, 1, 2, ...), do mesmo
+ * modo que Implementacao::adicionarVertice, e a busca do índice de uma chave
+ * é feita por tabela hash em O(1) esperado.
+ *
+ * Para chaves std::string há uma especialização que interna os textos em uma
+ * arena contígua: os caracteres de todos os rótulos ficam em sequência em um
+ * único vetor, e a tabela hash guarda apenas índices. Isso evita uma alocação
+ * por rótulo e mantém os rótulos próximos na memória.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class Rotulos
+ * @brief Conjunto de chaves distintas, cada uma associada ao índice em que
+ * foi inserida.
+ *
+ * @tparam Chave Tipo do rótulo; precisa de Hash e operator==.
+ */
+template <typename Chave, typename Hash = std::hash<Chave>> class Rotulos {
+  private:
+    std::vector<Chave> chaves;
+    std::unordered_map<Chave, int, Hash> indices;
+
+  public:
+    /**
+     * @brief Insere a chave com o próximo índice.
+     *
+     * @return Índice atribuído, ou -1 se a chave já existir.
+     */
+    int adicionar(const Chave &chave) {
+        int indice = int(chaves.size());
+        if (!indices.emplace(chave, indice).second)
+            return -1;
+        chaves.push_back(chave);
+        return indice;
+    }
+
+    /**
+     * @brief Retorna o índice da chave, ou -1 se ela não existir.
+     */
+    int buscar(const Chave &chave) const {
+        auto it = indices.find(chave);
+        return it == indices.end() ? -1 : it->second;
+    }
+
+    /**
+     * @brief Retorna a chave do índice i.
+     */
+    const Chave &operator[](int i) const { return chaves[i]; }
+
+    /**
+     * @brief Vetor contíguo das chaves, indexado pelo índice interno.
+     */
+    const Chave *dados() const { return chaves.data(); }
+
+    int getTamanho() const { return int(chaves.size()); }
+
+    std::size_t getMemoriaOcupada() const {
+        // Estimativa: cada nó da tabela guarda o par e o ponteiro do próximo
+        std::size_t t = sizeof(Rotulos);
+        t += sizeof(Chave) * chaves.capacity();
+        t += sizeof(void *) * indices.bucket_count();
+        t += (sizeof(std::pair<const Chave, int>) + sizeof(void *)) *
+             indices.size();
+        return t;
+    }
+};
+
+/**
+ * @class Rotulos<std::string>
+ * @brief Rótulos de texto internados em uma arena contígua.
+ *
+ * Estrutura:
+ * - `arena` guarda os caracteres de todos os rótulos, em sequência;
+ * - o rótulo i ocupa [inicio[i], inicio[i + 1]) da arena;
+ * - `tabela` é uma tabela hash de endereçamento aberto (sondagem linear) com
+ *   o índice de cada rótulo, ou -1 nas posições vazias; o hash completo de
+ *   cada rótulo fica em `hashes`, para comparar textos só quando os hashes
+ *   coincidem e para redimensionar sem recalculá-los.
+ */
+template <> class Rotulos<std::string> {
+  private:
+    std::vector<char> arena;
+    std::vector<std::size_t> inicio{0};
+    std::vector<std::size_t> hashes;
+    std::vector<int> tabela;
+
+    static std::size_t calcularHash(std::string_view s) {
+        return std::hash<std::string_view>()(s);
+    }
+
+    /**
+     * @brief Posição da tabela em que o texto s está ou deveria ser inserido.
+     */
+    std::size_t posicao(std::string_view s, std::size_t h) const {
+        std::size_t mascara = tabela.size() - 1;
+        std::size_t i = h & mascara;
+        while (tabela[i] != -1) {
+            int r = tabela[i];
+            if (hashes[r] == h && (*this)[r] == s)
+                break;
+            i = (i + 1) & mascara;
+        }
+        return i;
+    }
+
+    /**
+     * @brief Dobra a tabela (mínimo 16 posições) e reinsere os índices.
+     */
+    void crescerTabela() {
+        std::size_t novoTamanho = tabela.empty() ? 16 : 2 * tabela.size();
+        tabela.assign(novoTamanho, -1);
+        std::size_t mascara = novoTamanho - 1;
+        for (int r = 0; r < getTamanho(); r++) {
+            std::size_t i = hashes[r] & mascara;
+            while (tabela[i] != -1)
+                i = (i + 1) & mascara;
+            tabela[i] = r;
+        }
+    }
+
+  public:
+    /**
+     * @brief Interna o texto com o próximo índice.
+     *
+     * @return Índice atribuído, ou -1 se o texto já existir.
+     */
+    int adicionar(std::string_view s) {
+        // Carga máxima de 1/2
+        if (2 * (hashes.size() + 1) > tabela.size())
+            crescerTabela();
+
+        std::size_t h = calcularHash(s);
+        std::size_t i = posicao(s, h);
+        if (tabela[i] != -1)
+            return -1;
+
+        int indice = getTamanho();
+        arena.insert(arena.end(), s.begin(), s.end());
+        inicio.push_back(arena.size());
+        hashes.push_back(h);
+        tabela[i] = indice;
+        return indice;
+    }
+
+    /**
+     * @brief Retorna o índice do texto, ou -1 se ele não existir.
+     */
+    int buscar(std::string_view s) const {
+        if (tabela.empty())
+            return -1;
+        return tabela[posicao(s, calcularHash(s))];
+    }
+
+    /**
+     * @brief Retorna o texto do índice i. A visão é válida até a próxima
+     * inserção, que pode realocar a arena.
+     */
+    std::string_view operator[](int i) const {
+        return std::string_view(arena.data() + inicio[i],
+                                inicio[i + 1] - inicio[i]);
+    }
+
+    /**
+     * @brief Arena com os caracteres de todos os rótulos, em sequência.
+     */
+    const char *dados() const { return arena.data(); }
+
+    int getTamanho() const { return int(hashes.size()); }
+
+    std::size_t getMemoriaOcupada() const {
+        std::size_t t = sizeof(Rotulos);
+        t += arena.capacity();
+        t += sizeof(std::size_t) * (inicio.capacity() + hashes.capacity());
+        t += sizeof(int) * tabela.capacity();
+        return t;
+    }
+};
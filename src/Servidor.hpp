@@ -0,0 +1,812 @@
+/**
+ * @file Servidor.hpp
+ * @brief Modo servidor: o grafo é carregado uma única vez e responde a
+ * consultas por linha, lidas da entrada padrão ou de um socket Unix.
+ *
+ * Protocolo (uma consulta por linha, campos separados por espaços; vértices
+ * são rótulos se o grafo for rotulado, ou índices caso contrário):
+ * - `bfs s`      -> `bfs s <alcançados> <profundidade>`
+ * - `bfs s t`    -> `bfs s t <arestas até t | -1>`
+ * - `dfs s`      -> `dfs s <alcançados>`
+ * - `path s t`   -> `path s t <arestas | -1> [v0 v1 ... vk]`
+ * - `reach u v`  -> `reach u v <1 | 0>`
+ * - `sssp s`     -> `sssp s <alcançados> <maior distância>`
+ * - `sssp s t`   -> `sssp s t <distância até t | -1>`
+ * Linhas vazias ou iniciadas por '#' são ignoradas. Consultas inválidas
+ * recebem `erro <consulta>: <motivo>`. As respostas saem na ordem das
+ * consultas.
+ *
+ * Execução em lotes, em três estágios sobrepostos:
+ * 1. uma thread lê e separa as linhas, enquanto o lote anterior executa;
+ * 2. as consultas acumuladas (até tamanhoLote) formam um lote: as buscas em
+ *    largura do lote são agrupadas em MS-BFS (BuscaMultipla.hpp), que lê
+ *    cada lista de vizinhos uma vez para várias origens, e as demais
+ *    consultas viram tarefas individuais;
+ * 3. as tarefas são distribuídas entre threads fixas, cada uma com seus
+ *    vetores de trabalho reaproveitados entre consultas, e as respostas do
+ *    lote são escritas de uma vez, com escrita bufferizada.
+ *
+ * Com consultas chegando mais rápido do que são atendidas, os lotes crescem
+ * sozinhos e o agrupamento em MS-BFS fica mais eficiente. A leitura para
+ * quando há LOTES_EM_ESPERA lotes na fila, o que limita a memória e repassa a
+ * espera ao cliente.
+ *
+ * No socket Unix, cada conexão tem as suas threads de leitura e de escrita;
+ * os lotes de conexões diferentes se revezam no mesmo conjunto de threads.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <climits>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "Representacao.hpp"
+
+/**
+ * @class PoolThreads
+ * @brief Threads fixas que executam, a cada chamada de executar, as tarefas
+ * [0, tarefas) pegando a próxima de um contador atômico.
+ *
+ * A thread chamadora também trabalha, como trabalhador 0, assim como em
+ * paraCadaParte.
+ */
+class PoolThreads {
+  private:
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable inicio, fim;
+    std::function<void(int, int)> tarefa;
+    std::atomic<int> proxima{0};
+    int tTarefas = 0, pendentes = 0;
+    unsigned geracao = 0;
+    bool parar = false;
+
+    void trabalhar(int trabalhador) {
+        for (int i = proxima++; i < tTarefas; i = proxima++)
+            tarefa(trabalhador, i);
+    }
+
+    void laco(int trabalhador) {
+        unsigned vista = 0;
+        std::unique_lock<std::mutex> trava(mutex);
+        while (true) {
+            inicio.wait(trava, [&] { return parar || geracao != vista; });
+            if (parar)
+                return;
+            vista = geracao;
+            trava.unlock();
+            trabalhar(trabalhador);
+            trava.lock();
+            if (--pendentes == 0)
+                fim.notify_one();
+        }
+    }
+
+  public:
+    /**
+     * @param trabalhadores Quantidade total de trabalhadores, incluindo a
+     * thread chamadora.
+     */
+    explicit PoolThreads(int trabalhadores) {
+        for (int i = 1; i < trabalhadores; i++)
+            threads.emplace_back(&PoolThreads::laco, this, i);
+    }
+
+    PoolThreads(const PoolThreads &) = delete;
+    PoolThreads &operator=(const PoolThreads &) = delete;
+
+    ~PoolThreads() {
+        {
+            std::lock_guard<std::mutex> trava(mutex);
+            parar = true;
+        }
+        inicio.notify_all();
+        for (std::thread &t : threads)
+            t.join();
+    }
+
+    int getTrabalhadores() const { return int(threads.size()) + 1; }
+
+    /**
+     * @brief Executa f(trabalhador, tarefa) para cada tarefa em [0, tarefas)
+     * e retorna quando todas terminarem.
+     */
+    void executar(int tarefas, std::function<void(int, int)> f) {
+        {
+            std::lock_guard<std::mutex> trava(mutex);
+            tarefa = std::move(f);
+            tTarefas = tarefas;
+            proxima = 0;
+            pendentes = int(threads.size());
+            geracao++;
+        }
+        inicio.notify_all();
+        trabalhar(0);
+
+        std::unique_lock<std::mutex> trava(mutex);
+        fim.wait(trava, [&] { return pendentes == 0; });
+    }
+};
+
+/**
+ * @enum TipoConsulta
+ * @brief Comandos aceitos pelo servidor.
+ */
+enum class TipoConsulta { LARGURA, PROFUNDIDADE, CAMINHO, ALCANCA, DISTANCIA };
+
+/**
+ * @struct Consulta
+ * @brief Uma linha do protocolo, com os argumentos e a resposta.
+ *
+ * Campos:
+ * - eco: comando e argumentos como foram lidos, repetidos na resposta.
+ * - argumentos: vértices como foram lidos (rótulos ou índices).
+ * - s, t: índices internos (t = -1 se a consulta não tem destino).
+ * - erro: motivo da rejeição, ou nullptr se a consulta é válida.
+ * - resultado, extra: números da resposta (ver o protocolo).
+ * - caminho: vértices do caminho, para `path`.
+ */
+struct Consulta {
+    TipoConsulta tipo = TipoConsulta::LARGURA;
+    std::string eco;
+    long long argumentos[2] = {0, 0};
+    int tArgumentos = 0;
+    int s = -1, t = -1;
+    const char *erro = nullptr;
+    long long resultado = -1, extra = 0;
+    std::vector<int> caminho;
+};
+
+/**
+ * @struct EspacoConsultas
+ * @brief Vetores de trabalho de um trabalhador, reaproveitados entre
+ * consultas e lotes.
+ */
+struct EspacoConsultas {
+    EspacoBuscaMultipla<1> multipla1;
+    EspacoBuscaMultipla<4> multipla4;
+    EspacoBidirecional bidirecional;
+    std::unique_ptr<bool[]> marca;
+    std::vector<long long> dist; ///< -1 para vértices não alcançados.
+    std::vector<int> alcancados;
+    std::vector<std::pair<long long, int>> heap;
+
+    explicit EspacoConsultas(int n) : marca(new bool[n]()), dist(n, -1) {}
+};
+
+/**
+ * @class ServidorConsultas
+ * @brief Atende consultas sobre um grafo que não é modificado enquanto o
+ * servidor existe.
+ */
+class ServidorConsultas {
+  public:
+    /**
+     * @brief Quantidade máxima de origens por MS-BFS (máscaras de 256 bits).
+     */
+    static constexpr int MAX_ORIGENS_MULTIPLA = 256;
+
+    /**
+     * @brief Lotes completos que podem esperar na fila de uma conexão antes
+     * de a leitura parar.
+     */
+    static constexpr int LOTES_EM_ESPERA = 4;
+
+  private:
+    Grafo &grafo;
+    const IndiceCSR *saida;
+    const unsigned int *labels;
+    bool pesosNaoNegativos = true;
+    int tamanhoLote;
+    PoolThreads pool;
+    std::vector<std::unique_ptr<EspacoConsultas>> espacos;
+    std::mutex execucao; ///< Um lote por vez no pool, entre conexões.
+
+    /**
+     * @brief Separa a linha em comando e argumentos.
+     *
+     * @return false se a linha deve ser ignorada.
+     */
+    static bool interpretar(const char *b, const char *e, Consulta &c) {
+        const char *tokens[4][2];
+        int tTokens = 0;
+        while (b < e) {
+            while (b < e && (*b == ' ' || *b == '\t' || *b == '\r'))
+                b++;
+            if (b == e)
+                break;
+            const char *inicio = b;
+            while (b < e && *b != ' ' && *b != '\t' && *b != '\r')
+                b++;
+            if (tTokens == 4) {
+                tTokens++;
+                break;
+            }
+            tokens[tTokens][0] = inicio;
+            tokens[tTokens][1] = b;
+            tTokens++;
+        }
+        if (tTokens == 0 || *tokens[0][0] == '#')
+            return false;
+
+        for (int i = 0; i < std::min(tTokens, 4); i++) {
+            if (i > 0)
+                c.eco += ' ';
+            c.eco.append(tokens[i][0], tokens[i][1]);
+        }
+
+        std::string comando(tokens[0][0], tokens[0][1]);
+        int minimo = 2, maximo = 2;
+        if (comando == "bfs") {
+            c.tipo = TipoConsulta::LARGURA;
+            minimo = 1;
+        } else if (comando == "dfs") {
+            c.tipo = TipoConsulta::PROFUNDIDADE;
+            minimo = maximo = 1;
+        } else if (comando == "path") {
+            c.tipo = TipoConsulta::CAMINHO;
+        } else if (comando == "reach") {
+            c.tipo = TipoConsulta::ALCANCA;
+        } else if (comando == "sssp") {
+            c.tipo = TipoConsulta::DISTANCIA;
+            minimo = 1;
+        } else {
+            c.erro = "comando desconhecido";
+            return true;
+        }
+
+        c.tArgumentos = tTokens - 1;
+        if (c.tArgumentos < minimo || c.tArgumentos > maximo) {
+            c.erro = "quantidade de argumentos inválida";
+            return true;
+        }
+        for (int i = 0; i < c.tArgumentos; i++) {
+            const char *ib = tokens[i + 1][0], *ie = tokens[i + 1][1];
+            std::from_chars_result r = std::from_chars(ib, ie, c.argumentos[i]);
+            if (r.ec != std::errc() || r.ptr != ie) {
+                c.erro = "vértice inválido";
+                return true;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Converte um argumento (rótulo ou índice) para o índice interno.
+     */
+    int resolver(long long v) {
+        if (grafo.isRotulado()) {
+            if (v < 0 || v > 0xFFFFFFFFLL)
+                return -1;
+            return grafo.getIndice(int(unsigned(v)));
+        }
+        if (v < 0 || v >= saida->tamanho)
+            return -1;
+        return int(v);
+    }
+
+    /**
+     * @brief Busca em largura (MS-BFS) para as consultas `bfs` do grupo.
+     */
+    template <int W>
+    void executarLarguras(Consulta **grupo, int k, EspacoBuscaMultipla<W> &e) {
+        int origens[64 * W];
+        for (int i = 0; i < k; i++) {
+            origens[i] = grupo[i]->s;
+            grupo[i]->resultado = grupo[i]->t == -1 ? 0 : -1;
+        }
+        buscaEmLarguraMultiplaBloco<W>(
+            *saida, origens, k, e, [&](int i, int w, int nivel) {
+                Consulta &c = *grupo[i];
+                if (c.t == -1) {
+                    c.resultado++;
+                    c.extra = nivel;
+                } else if (w == c.t) {
+                    c.resultado = nivel;
+                }
+            });
+    }
+
+    void executarProfundidade(Consulta &c, EspacoConsultas &e) {
+        int n = saida->tamanho;
+        std::fill(e.marca.get(), e.marca.get() + n, false);
+        c.resultado = profundidadeComPrefetch(
+            n, c.s, e.marca.get(),
+            AdjacenciaCSR<>{saida->inicio, saida->arestas});
+    }
+
+    /**
+     * @brief Dijkstra a partir de c.s, parando ao fechar c.t (se houver).
+     * Limpa apenas os vértices alcançados.
+     */
+    void executarDistancia(Consulta &c, EspacoConsultas &e) {
+        typedef std::pair<long long, int> item;
+        std::greater<item> maior;
+        e.heap.clear();
+        e.alcancados.clear();
+        e.dist[c.s] = 0;
+        e.alcancados.push_back(c.s);
+        e.heap.push_back({0, c.s});
+
+        long long maximo = 0;
+        int fechados = 0;
+        c.resultado = -1;
+        while (!e.heap.empty()) {
+            std::pop_heap(e.heap.begin(), e.heap.end(), maior);
+            item topo = e.heap.back();
+            e.heap.pop_back();
+            int w = topo.second;
+            if (topo.first != e.dist[w])
+                continue;
+            fechados++;
+            maximo = topo.first;
+            if (w == c.t) {
+                c.resultado = topo.first;
+                break;
+            }
+            for (const tupla *t = saida->inicioVizinhos(w);
+                 t != saida->fimVizinhos(w); t++) {
+                int x = t->vertice;
+                long long d = topo.first + t->peso;
+                if (e.dist[x] == -1)
+                    e.alcancados.push_back(x);
+                else if (d >= e.dist[x])
+                    continue;
+                e.dist[x] = d;
+                e.heap.push_back({d, x});
+                std::push_heap(e.heap.begin(), e.heap.end(), maior);
+            }
+        }
+        if (c.t == -1) {
+            c.resultado = fechados;
+            c.extra = maximo;
+        }
+
+        for (int w : e.alcancados)
+            e.dist[w] = -1;
+    }
+
+    /**
+     * @brief Valida as consultas, prepara os índices necessários e executa o
+     * lote no pool.
+     */
+    void executarLote(std::vector<Consulta> &lote) {
+        std::vector<Consulta *> larguras, outras;
+        bool precisaEntrada = false, precisaAlcance = false;
+        for (Consulta &c : lote) {
+            if (c.erro != nullptr)
+                continue;
+            c.s = resolver(c.argumentos[0]);
+            c.t = c.tArgumentos > 1 ? resolver(c.argumentos[1]) : -1;
+            if (c.s == -1 || (c.tArgumentos > 1 && c.t == -1)) {
+                c.erro = "vértice inexistente";
+                continue;
+            }
+            if (c.tipo == TipoConsulta::DISTANCIA && !pesosNaoNegativos) {
+                c.erro = "o grafo possui pesos negativos";
+                continue;
+            }
+
+            if (c.tipo == TipoConsulta::LARGURA) {
+                larguras.push_back(&c);
+                continue;
+            }
+            precisaEntrada |= c.tipo == TipoConsulta::CAMINHO;
+            precisaAlcance |= c.tipo == TipoConsulta::ALCANCA;
+            outras.push_back(&c);
+        }
+
+        // Índices construídos sob demanda, antes de as threads os lerem
+        const IndiceCSR *entrada =
+            precisaEntrada ? grafo.obterIndiceEntrada() : nullptr;
+        const IndiceAlcancabilidade *alcance =
+            precisaAlcance ? grafo.obterIndiceAlcancabilidade() : nullptr;
+
+        // Grupos de MS-BFS, no máximo um por trabalhador se couberem
+        int k = int(larguras.size()), trabalhadores = pool.getTrabalhadores();
+        int porGrupo = std::min(MAX_ORIGENS_MULTIPLA,
+                                (k + trabalhadores - 1) / trabalhadores);
+        int grupos = porGrupo > 0 ? (k + porGrupo - 1) / porGrupo : 0;
+
+        pool.executar(grupos + int(outras.size()), [&](int p, int i) {
+            EspacoConsultas &e = *espacos[p];
+            if (i < grupos) {
+                int b = i * porGrupo, tam = std::min(porGrupo, k - b);
+                if (tam <= 64)
+                    executarLarguras<1>(&larguras[b], tam, e.multipla1);
+                else
+                    executarLarguras<4>(&larguras[b], tam, e.multipla4);
+                return;
+            }
+
+            Consulta &c = *outras[i - grupos];
+            switch (c.tipo) {
+            case TipoConsulta::PROFUNDIDADE:
+                executarProfundidade(c, e);
+                break;
+            case TipoConsulta::CAMINHO:
+                c.resultado = buscaBidirecional(*saida, *entrada, c.s, c.t,
+                                                e.bidirecional, c.caminho);
+                break;
+            case TipoConsulta::ALCANCA:
+                c.resultado = alcance->alcanca(c.s, c.t) ? 1 : 0;
+                break;
+            case TipoConsulta::DISTANCIA:
+                executarDistancia(c, e);
+                break;
+            default:
+                break;
+            }
+        });
+    }
+
+    void escreverResposta(const Consulta &c, EscritorBuffer &saidaTexto) {
+        if (c.erro != nullptr) {
+            saidaTexto.escrever("erro ");
+            saidaTexto.escrever(c.eco.data(), c.eco.size());
+            saidaTexto.escrever(": ");
+            saidaTexto.escrever(c.erro);
+            saidaTexto.escrever('\n');
+            return;
+        }
+
+        saidaTexto.escrever(c.eco.data(), c.eco.size());
+        saidaTexto.escrever(' ');
+        saidaTexto.escreverInteiro(c.resultado);
+        bool semDestino = c.t == -1 && (c.tipo == TipoConsulta::LARGURA ||
+                                        c.tipo == TipoConsulta::DISTANCIA);
+        if (semDestino) {
+            saidaTexto.escrever(' ');
+            saidaTexto.escreverInteiro(c.extra);
+        }
+        if (c.tipo == TipoConsulta::CAMINHO) {
+            for (int v : c.caminho) {
+                saidaTexto.escrever(' ');
+                saidaTexto.escreverInteiro(labels ? (long long)labels[v] : v);
+            }
+        }
+        saidaTexto.escrever('\n');
+    }
+
+  public:
+    /**
+     * @param grafo Grafo consultado; não deve ser modificado enquanto o
+     * servidor existir. Se ele não tiver índice CSR (ver
+     * Grafo::obterIndiceSaida), o servidor fica inválido e não atende
+     * consultas.
+     * @param threads Quantidade de trabalhadores (0 usa numeroThreads()).
+     * @param tamanhoLote Quantidade máxima de consultas por lote.
+     */
+    explicit ServidorConsultas(Grafo &grafo, int threads = 0,
+                               int tamanhoLote = 1024)
+        : grafo(grafo), saida(grafo.obterIndiceSaida()),
+          labels(grafo.getLabels()), tamanhoLote(std::max(1, tamanhoLote)),
+          pool(threads > 0 ? threads : numeroThreads()) {
+        if (saida == nullptr)
+            return;
+        for (int i = 0; i < saida->tArestas; i++)
+            if (saida->arestas[i].peso < 0)
+                pesosNaoNegativos = false;
+        for (int i = 0; i < pool.getTrabalhadores(); i++)
+            espacos.emplace_back(new EspacoConsultas(saida->tamanho));
+    }
+
+    /**
+     * @brief Indica se o grafo tinha índice CSR e o servidor pode atender.
+     */
+    bool isValido() const { return saida != nullptr; }
+
+    /**
+     * @brief Lê consultas de `entrada` até o fim do arquivo e escreve as
+     * respostas em `saidaFd`.
+     *
+     * Pode ser chamado por várias threads ao mesmo tempo, uma por conexão.
+     *
+     * @return false se houve erro de escrita ou o servidor for inválido.
+     */
+    bool atender(int entrada, int saidaFd) {
+        if (!isValido())
+            return false;
+
+        std::mutex mutex;
+        std::condition_variable chegou, liberou;
+        std::deque<Consulta> fila;
+        bool fimEntrada = false;
+        std::size_t limiteFila = std::size_t(LOTES_EM_ESPERA) * tamanhoLote;
+
+        // Estágio 1: leitura e separação das linhas
+        std::thread leitor([&] {
+            std::vector<char> buffer(1 << 16);
+            std::string resto;
+            std::vector<Consulta> novas;
+            auto separar = [&](const char *b, const char *e) {
+                Consulta c;
+                if (interpretar(b, e, c))
+                    novas.push_back(std::move(c));
+            };
+
+            while (true) {
+                ssize_t lidos = ::read(entrada, buffer.data(), buffer.size());
+                if (lidos < 0 && errno == EINTR)
+                    continue;
+                if (lidos <= 0)
+                    break;
+
+                const char *b = buffer.data(), *e = b + lidos;
+                for (const char *q; (q = (const char *)std::memchr(
+                                         b, '\n', std::size_t(e - b)));
+                     b = q + 1) {
+                    if (resto.empty()) {
+                        separar(b, q);
+                    } else {
+                        resto.append(b, q);
+                        separar(resto.data(), resto.data() + resto.size());
+                        resto.clear();
+                    }
+                }
+                resto.append(b, e);
+
+                if (!novas.empty()) {
+                    std::unique_lock<std::mutex> trava(mutex);
+                    for (Consulta &c : novas)
+                        fila.push_back(std::move(c));
+                    chegou.notify_one();
+                    liberou.wait(trava,
+                                 [&] { return fila.size() < limiteFila; });
+                }
+                novas.clear();
+            }
+            if (!resto.empty())
+                separar(resto.data(), resto.data() + resto.size());
+
+            std::lock_guard<std::mutex> trava(mutex);
+            for (Consulta &c : novas)
+                fila.push_back(std::move(c));
+            fimEntrada = true;
+            chegou.notify_one();
+        });
+
+        // Estágios 2 e 3: execução em lotes e escrita das respostas
+        EscritorBuffer saidaTexto(saidaFd);
+        std::vector<Consulta> lote;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> trava(mutex);
+                chegou.wait(trava, [&] { return !fila.empty() || fimEntrada; });
+                if (fila.empty())
+                    break;
+                int n = std::min(int(fila.size()), tamanhoLote);
+                lote.clear();
+                for (int i = 0; i < n; i++) {
+                    lote.push_back(std::move(fila.front()));
+                    fila.pop_front();
+                }
+                liberou.notify_one();
+            }
+
+            {
+                std::lock_guard<std::mutex> trava(execucao);
+                executarLote(lote);
+            }
+            for (const Consulta &c : lote)
+                escreverResposta(c, saidaTexto);
+            saidaTexto.descarregar();
+        }
+
+        leitor.join();
+        return saidaTexto.descarregar();
+    }
+};
+
+/**
+ * @brief Atende conexões em um socket Unix até o processo ser encerrado.
+ *
+ * Cada conexão é atendida por uma thread própria, então um cliente ocioso
+ * não impede os demais. As threads de conexões encerradas são recolhidas a
+ * cada nova conexão.
+ *
+ * @param caminho Caminho do socket; um arquivo existente é substituído.
+ * @return false se o socket não pôde ser criado ou deixou de aceitar
+ * conexões.
+ */
+inline bool servirSocketUnix(ServidorConsultas &servidor, const char *caminho) {
+    if (!servidor.isValido())
+        return false;
+
+    sockaddr_un endereco;
+    std::memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    if (std::strlen(caminho) >= sizeof(endereco.sun_path))
+        return false;
+    std::strcpy(endereco.sun_path, caminho);
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+        return false;
+    ::unlink(caminho);
+    if (::bind(fd, (const sockaddr *)&endereco, sizeof(endereco)) < 0 ||
+        ::listen(fd, 16) < 0) {
+        ::close(fd);
+        return false;
+    }
+
+    struct Conexao {
+        int fd;
+        std::thread thread;
+        std::shared_ptr<std::atomic<bool>> terminou;
+    };
+    std::vector<Conexao> conexoes;
+
+    // Um cliente que desconecta no meio de uma resposta não derruba o servidor
+    std::signal(SIGPIPE, SIG_IGN);
+    while (true) {
+        int cliente = ::accept(fd, nullptr, nullptr);
+        if (cliente < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        // Recolhe as conexões já encerradas
+        std::size_t ativas = 0;
+        for (std::size_t i = 0; i < conexoes.size(); i++) {
+            if (conexoes[i].terminou->load()) {
+                conexoes[i].thread.join();
+                ::close(conexoes[i].fd);
+            } else if (i != ativas) {
+                conexoes[ativas++] = std::move(conexoes[i]);
+            } else {
+                ativas++;
+            }
+        }
+        conexoes.erase(conexoes.begin() + ativas, conexoes.end());
+
+        auto terminou = std::make_shared<std::atomic<bool>>(false);
+        // O cliente recebe o fim da conexão já aqui; o descritor só é
+        // fechado ao recolher a thread, para não ser reaproveitado antes
+        std::thread t([&servidor, cliente, terminou] {
+            servidor.atender(cliente, cliente);
+            ::shutdown(cliente, SHUT_RDWR);
+            terminou->store(true);
+        });
+        conexoes.push_back({cliente, std::move(t), terminou});
+    }
+
+    // Encerra a leitura das conexões restantes antes de esperá-las
+    for (Conexao &c : conexoes) {
+        ::shutdown(c.fd, SHUT_RDWR);
+        c.thread.join();
+        ::close(c.fd);
+    }
+    ::close(fd);
+    return false;
+}
+
+/**
+ * @brief Lê um arquivo de lista de arestas (`u v [peso]` por linha,
+ * separados por espaços, tabulações ou vírgulas), como os escritos por
+ * exportarGrafo, chamando visitar(a) para cada aresta.
+ *
+ * Linhas que não começam por um número (comentários, cabeçalho CSV) ou com
+ * vértice ou peso fora do intervalo de int são ignoradas. Sem ponderado, o
+ * peso é 1.
+ *
+ * @return false se o arquivo não pôde ser lido.
+ */
+template <typename F>
+bool lerListaArestas(const char *caminho, bool ponderado, F visitar) {
+    int fd = ::open(caminho, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    std::vector<char> buffer(1 << 20);
+    std::string linha;
+    auto lerLinha = [&](const char *b, const char *e) {
+        long long campos[3];
+        int tCampos = 0;
+        while (b < e && tCampos < 3) {
+            while (b < e && (*b == ' ' || *b == '\t' || *b == ',' ||
+                             *b == '\r'))
+                b++;
+            std::from_chars_result r = std::from_chars(b, e, campos[tCampos]);
+            if (r.ec != std::errc())
+                break;
+            b = r.ptr;
+            tCampos++;
+        }
+        if (tCampos < 2 || campos[0] < 0 || campos[1] < 0 ||
+            campos[0] >= 0x7FFFFFFF || campos[1] >= 0x7FFFFFFF)
+            return;
+        if (ponderado && tCampos == 3 &&
+            (campos[2] < INT_MIN || campos[2] > INT_MAX))
+            return;
+        visitar(tAresta{int(campos[0]), int(campos[1]),
+                        ponderado && tCampos == 3 ? int(campos[2]) : 1});
+    };
+
+    ssize_t lidos;
+    while ((lidos = ::read(fd, buffer.data(), buffer.size())) != 0) {
+        if (lidos < 0) {
+            if (errno == EINTR)
+                continue;
+            ::close(fd);
+            return false;
+        }
+        const char *b = buffer.data(), *e = b + lidos;
+        for (const char *q;
+             (q = (const char *)std::memchr(b, '\n', std::size_t(e - b)));
+             b = q + 1) {
+            linha.append(b, q);
+            lerLinha(linha.data(), linha.data() + linha.size());
+            linha.clear();
+        }
+        linha.append(b, e);
+    }
+    lerLinha(linha.data(), linha.data() + linha.size());
+    ::close(fd);
+    return true;
+}
+
+/**
+ * @brief Conta as arestas de um arquivo de lista de arestas (ver
+ * lerListaArestas) sem guardá-las.
+ *
+ * @return Quantidade de arestas, ou -1 se o arquivo não pôde ser lido.
+ */
+inline long long contarListaArestas(const char *caminho, bool ponderado) {
+    long long tArestas = 0;
+    if (!lerListaArestas(caminho, ponderado,
+                         [&](const tAresta &) { tArestas++; }))
+        return -1;
+    return tArestas;
+}
+
+/**
+ * @brief Carrega um grafo de um arquivo de lista de arestas (ver
+ * lerListaArestas).
+ *
+ * Os vértices são os índices 0 .. maior índice lido, e a representação é
+ * escolhida por escolherRepresentacao. As arestas são inseridas em lotes que
+ * cabem no int de Grafo::adicionarArestas.
+ *
+ * @return Novo grafo, de responsabilidade do chamador, ou nullptr se o
+ * arquivo não pôde ser lido.
+ */
+inline Grafo *carregarListaArestas(const char *caminho, bool direcionado,
+                                   bool ponderado) {
+    std::vector<tAresta> arestas;
+    int maior = -1;
+    if (!lerListaArestas(caminho, ponderado, [&](const tAresta &a) {
+            maior = std::max(maior, std::max(a.origem, a.destino));
+            arestas.push_back(a);
+        }))
+        return nullptr;
+
+    Grafo *grafo = criarGrafo(maior + 1, (long long)arestas.size(),
+                              direcionado, ponderado, false);
+    for (int v = 0; v <= maior; v++)
+        grafo->adicionarVertice(v);
+    // Em grafos não direcionados o lote dobra com as arestas inversas
+    const std::size_t lote = INT_MAX / 2;
+    for (std::size_t i = 0; i < arestas.size(); i += lote)
+        grafo->adicionarArestas(arestas.data() + i,
+                                int(std::min(lote, arestas.size() - i)));
+    return grafo;
+}
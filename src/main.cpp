@@ -1,9 +1,13 @@
 #include "Grafo.hpp"
 #include "ListaAdjacencia.hpp"
 #include "MatrizAdjacencia.hpp"
+#include "Representacao.hpp"
+#include "Servidor.hpp"
 #include <algorithm>
 #include <chrono>
+#include <climits>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include <random>
 #include <vector>
@@ -75,6 +79,20 @@ void testarImplementacao(Grafo *grafo, const std::string &nome,
     std::chrono::duration<double, std::milli> tempo_profundidade =
         soma_tempos / 100;
 
+    std::vector<double> rank(grafo->getTamanho());
+    const auto inicio_pagerank = std::chrono::high_resolution_clock::now();
+    grafo->pageRank(rank.data(), false);
+    const auto fim_pagerank = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> tempo_pagerank =
+        fim_pagerank - inicio_pagerank;
+
+    // Exportação bufferizada, sem o custo de formatação do std::cout
+    const auto inicio_exporta = std::chrono::high_resolution_clock::now();
+    grafo->exportar("/dev/null", FormatoExportacao::LISTA_ARESTAS);
+    const auto fim_exporta = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> tempo_exportar =
+        fim_exporta - inicio_exporta;
+
     std::size_t tamanhoKb = grafo->getMemoriaOcupada() / 1024;
 
     std::cout << "\nEspaço ocupado em memória: " << tamanhoKb << " KB"
@@ -83,35 +101,205 @@ void testarImplementacao(Grafo *grafo, const std::string &nome,
     if (medirImpressoes)
         std::cout << "\nTempo para exibir: " << tempo_imprimir.count() << " ms"
                   << std::endl;
+    std::cout << "\nTempo para exportar (lista de arestas): "
+              << tempo_exportar.count() << " ms" << std::endl;
     std::cout << "\nTempo do caminhamento em largura: " << tempo_largura.count()
               << " ms" << std::endl;
     std::cout << "\nTempo do caminhamento em profundidade: "
               << tempo_profundidade.count() << " ms" << std::endl;
+    std::cout << "\nTempo do PageRank (push): " << tempo_pagerank.count()
+              << " ms" << std::endl;
     std::cout << "\nTempo total: "
               << tempo_imprimir.count() + tempo_largura.count() +
                      tempo_profundidade.count()
               << " ms" << std::endl;
 }
 
-int main() {
+/**
+ * @brief Modo servidor: carrega o grafo uma vez e atende consultas (ver
+ * Servidor.hpp) até o fim da entrada padrão, ou indefinidamente no socket.
+ *
+ * Uso: main --servidor <lista de arestas> [--direcionado] [--ponderado]
+ * [--threads n] [--socket caminho]
+ */
+int executarServidor(int argc, char **argv) {
+    const char *arquivo = nullptr, *socket = nullptr;
+    bool direcionado = false, ponderado = false;
+    int threads = 0;
+    for (int i = 2; i < argc; i++) {
+        if (std::strcmp(argv[i], "--direcionado") == 0)
+            direcionado = true;
+        else if (std::strcmp(argv[i], "--ponderado") == 0)
+            ponderado = true;
+        else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            threads = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--socket") == 0 && i + 1 < argc)
+            socket = argv[++i];
+        else
+            arquivo = argv[i];
+    }
+    if (arquivo == nullptr) {
+        std::cerr << "Uso: " << argv[0]
+                  << " --servidor <lista de arestas> [--direcionado]"
+                     " [--ponderado] [--threads n] [--socket caminho]"
+                  << std::endl;
+        return 1;
+    }
+
+    // O servidor responde sobre o índice CSR de 32 bits: recusa antes de
+    // carregar um grafo que não caberia nele (grafos não direcionados
+    // guardam cada aresta nas duas direções)
+    long long tArestas = contarListaArestas(arquivo, ponderado);
+    long long limite = direcionado ? INT_MAX : INT_MAX / 2;
+    if (tArestas > limite) {
+        std::cerr << arquivo << " tem " << tArestas
+                  << " arestas; o servidor usa o índice CSR de 32 bits e"
+                     " aceita até "
+                  << limite << " arestas neste grafo" << std::endl;
+        return 1;
+    }
+
+    Grafo *grafo = tArestas < 0 ? nullptr
+                                : carregarListaArestas(arquivo, direcionado,
+                                                       ponderado);
+    if (grafo == nullptr) {
+        std::cerr << "Não foi possível ler " << arquivo << std::endl;
+        return 1;
+    }
+
+    int resp = 0;
+    {
+        ServidorConsultas servidor(*grafo, threads);
+        if (!servidor.isValido()) {
+            std::cerr << "Grafo grande demais para o índice CSR" << std::endl;
+            resp = 1;
+        } else if (socket != nullptr) {
+            if (!servirSocketUnix(servidor, socket)) {
+                std::cerr << "Não foi possível abrir o socket " << socket
+                          << std::endl;
+                resp = 1;
+            }
+        } else if (!servidor.atender(0, 1)) {
+            resp = 1;
+        }
+    }
+    delete grafo;
+    return resp;
+}
+
+/**
+ * @brief Modo NUMA: compara a busca em largura e o PageRank (push) comuns
+ * com as versões sobre o índice particionado por nó (ver ParticaoNUMA.hpp).
+ *
+ * O grafo é aleatório e direcionado, com 2^logVertices vértices; com os
+ * valores padrão (2^21 vértices, grau 16) o CSR ocupa 256 MB, mais que a
+ * cache de último nível, de modo que o tempo medido é o dos acessos à
+ * memória e não o de criação de threads.
+ *
+ * Uso: main --numa [log2 da quantidade de vértices] [grau médio]
+ */
+int executarNUMA(int argc, char **argv) {
+    int logVertices = argc > 2 ? std::atoi(argv[2]) : 21;
+    int grau = argc > 3 ? std::atoi(argv[3]) : 16;
+    if (logVertices < 1 || logVertices > 26 || grau < 1 ||
+        ((long long)grau << logVertices) > INT_MAX) {
+        std::cerr << "Uso: " << argv[0]
+                  << " --numa [log2 de vértices, até 26] [grau médio]"
+                  << std::endl;
+        return 1;
+    }
+    int n = 1 << logVertices;
+
+    Grafo *grafo = criarGrafo(n, (long long)n * grau, true, false, false);
+    for (int i = 0; i < n; i++)
+        grafo->adicionarVertice(i);
+    {
+        std::mt19937 rng(1);
+        std::vector<tAresta> arestas((std::size_t)n * grau);
+        for (tAresta &a : arestas)
+            a = {int(rng() % n), int(rng() % n), 1};
+        grafo->adicionarArestas(arestas.data(), int(arestas.size()));
+    }
+
+    using Relogio = std::chrono::steady_clock;
+    auto ms = [](Relogio::time_point a, Relogio::time_point b) {
+        return std::chrono::duration<double, std::milli>(b - a).count();
+    };
+
+    // dist não é inicializado: cada thread toca primeiro o seu intervalo
+    int *dist = new int[n];
+    auto t0 = Relogio::now();
+    grafo->caminhamentoEmLarguraNUMA(0, dist);
+    auto t1 = Relogio::now();
+    delete[] dist;
+
+    const int REPETICOES = 5;
+    double largura = 0, larguraNUMA = 0;
+    for (int i = 0; i < REPETICOES; i++) {
+        auto a = Relogio::now();
+        grafo->caminhamentoEmLargura(i);
+        auto b = Relogio::now();
+        dist = new int[n];
+        grafo->caminhamentoEmLarguraNUMA(i, dist);
+        auto c = Relogio::now();
+        delete[] dist;
+        largura += ms(a, b) / REPETICOES;
+        larguraNUMA += ms(b, c) / REPETICOES;
+    }
+
+    // Tolerância 0: as duas versões fazem as mesmas 10 iterações
+    std::vector<double> rank(n);
+    auto p0 = Relogio::now();
+    grafo->pageRank(rank.data(), false, 0, 10);
+    auto p1 = Relogio::now();
+    grafo->pageRankNUMA(rank.data(), 0, 10);
+    auto p2 = Relogio::now();
+
+    std::cout << "Vértices: " << n << ", arestas: " << (long long)n * grau
+              << ", nós NUMA: " << TopologiaNUMA::detectar().getNos()
+              << std::endl;
+    std::cout << "Construção do índice particionado: " << ms(t0, t1) << " ms"
+              << std::endl;
+    std::cout << "Caminhamento em largura: " << largura << " ms" << std::endl;
+    std::cout << "Caminhamento em largura (NUMA): " << larguraNUMA << " ms"
+              << std::endl;
+    std::cout << "PageRank push, 10 iterações: " << ms(p0, p1) << " ms"
+              << std::endl;
+    std::cout << "PageRank push, 10 iterações (NUMA): " << ms(p1, p2) << " ms"
+              << std::endl;
+    delete grafo;
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1 && std::strcmp(argv[1], "--servidor") == 0)
+        return executarServidor(argc, argv);
+    if (argc > 1 && std::strcmp(argv[1], "--numa") == 0)
+        return executarNUMA(argc, argv);
+
     for (int i = 0; i < 4; ++i) {
         bool direcionado = bool(i & 1);
         bool denso = bool(i & 2);
 
-        Grafo *gMatriz =
-            new Grafo(new MatrizAdjacencia(), direcionado, false, false);
-        Grafo *gLista =
-            new Grafo(new ListaAdjacencia(), direcionado, false, false);
-
         std::vector<std::pair<int, int>> *arestas = nullptr;
         if (denso)
             arestas = gerarArestasDenso(direcionado);
         else
             arestas = gerarArestasEsparso(direcionado);
 
+        Grafo *gMatriz =
+            new Grafo(new MatrizAdjacencia(), direcionado, false, false);
+        Grafo *gLista =
+            new Grafo(new ListaAdjacencia(), direcionado, false, false);
+        Representacao escolhida = escolherRepresentacao(
+            TAM, arestas->size(), direcionado, false);
+        Grafo *gAuto = criarGrafo(TAM, arestas->size(), direcionado, false,
+                                  false, escolhida);
+
         for (int i = 0; i < TAM; i++) {
             gMatriz->adicionarVertice(i);
             gLista->adicionarVertice(i);
+            gAuto->adicionarVertice(i);
         }
 
         for (int i = 0; i < arestas->size(); i++) {
@@ -119,6 +307,8 @@ int main() {
                                      arestas->at(i).second);
             gLista->adicionarAresta(arestas->at(i).first,
                                     arestas->at(i).second);
+            gAuto->adicionarAresta(arestas->at(i).first,
+                                   arestas->at(i).second);
         }
 
         std::cout
@@ -143,8 +333,22 @@ int main() {
 
         testarImplementacao(gLista, "Lista de Adjacência", false);
 
+        std::cout
+            << "\n-----------------------------------------------------------"
+               "-------------------------------------\n"
+            << std::endl;
+
+        std::cout << "Escolha automática: "
+                  << (escolhida == Representacao::MATRIZ     ? "Matriz"
+                      : escolhida == Representacao::HIBRIDA  ? "Híbrida"
+                      : escolhida == Representacao::LISTA_64 ? "Lista 64 bits"
+                                                             : "Lista Dinâmica")
+                  << std::endl;
+        testarImplementacao(gAuto, "Automática", false);
+
         delete gMatriz;
         delete gLista;
+        delete gAuto;
     }
 
     return 0;